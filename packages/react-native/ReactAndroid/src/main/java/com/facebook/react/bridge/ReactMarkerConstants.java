@@ -88,6 +88,8 @@ public enum ReactMarkerConstants {
   CREATE_MC_MODULE_GET_METADATA_END,
   REGISTER_JS_SEGMENT_START,
   REGISTER_JS_SEGMENT_STOP,
+  NATIVE_REQUIRE_PREFETCH_HIT,
+  NATIVE_REQUIRE_PREFETCH_MISS,
   VM_INIT,
   ON_FRAGMENT_CREATE,
   JAVASCRIPT_EXECUTOR_FACTORY_INJECT_START,
@@ -80,6 +80,8 @@ public class Binding {
 
   public native void driveCxxAnimations();
 
+  public native void reportFrame(long frameTimeNanos);
+
   public native ReadableNativeMap getInspectorDataForInstance(
       EventEmitterWrapper eventEmitterWrapper);
 
@@ -1209,6 +1209,12 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
         mBinding.driveCxxAnimations();
       }
 
+      // Let the JS thread know when the next frame starts, so it can yield
+      // before that.
+      if (mBinding != null) {
+        mBinding.reportFrame(frameTimeNanos);
+      }
+
       try {
         mMountItemDispatcher.dispatchPreMountItems(frameTimeNanos);
         mMountItemDispatcher.tryDispatchMountItems();
@@ -101,6 +101,20 @@ void Binding::driveCxxAnimations() {
   scheduler_->animationTick();
 }
 
+void Binding::reportFrame(jlong frameTimeNanos) {
+  std::shared_lock lock(installMutex_);
+  auto runtimeScheduler = runtimeScheduler_.lock();
+  if (!runtimeScheduler) {
+    return;
+  }
+
+  // `frameTimeNanos` is based on `System.nanoTime()`, which uses the same
+  // monotonic clock as `RuntimeSchedulerClock`.
+  runtimeScheduler->onFrame(RuntimeSchedulerTimePoint(
+      std::chrono::duration_cast<RuntimeSchedulerDuration>(
+          std::chrono::nanoseconds(frameTimeNanos))));
+}
+
 #pragma mark - Surface management
 
 void Binding::startSurface(
@@ -399,6 +413,7 @@ void Binding::installFabricUIManager(
       contextContainer->insert(
           "RuntimeScheduler",
           std::weak_ptr<RuntimeScheduler>(runtimeScheduler));
+      runtimeScheduler_ = runtimeScheduler;
     }
   }
 
@@ -473,6 +488,7 @@ void Binding::uninstallFabricUIManager() {
   std::unique_lock lock(installMutex_);
   animationDriver_ = nullptr;
   scheduler_ = nullptr;
+  runtimeScheduler_.reset();
   mountingManager_ = nullptr;
   reactNativeConfig_ = nullptr;
 }
@@ -593,6 +609,7 @@ void Binding::registerNatives() {
       makeNativeMethod("setConstraints", Binding::setConstraints),
       makeNativeMethod("setPixelDensity", Binding::setPixelDensity),
       makeNativeMethod("driveCxxAnimations", Binding::driveCxxAnimations),
+      makeNativeMethod("reportFrame", Binding::reportFrame),
       makeNativeMethod(
           "uninstallFabricUIManager", Binding::uninstallFabricUIManager),
       makeNativeMethod("registerSurface", Binding::registerSurface),
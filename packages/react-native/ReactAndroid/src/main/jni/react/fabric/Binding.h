@@ -120,12 +120,15 @@ class Binding : public jni::HybridClass<Binding>,
 
   void driveCxxAnimations();
 
+  void reportFrame(jlong frameTimeNanos);
+
   void uninstallFabricUIManager();
 
   // Private member variables
   std::shared_mutex installMutex_;
   std::shared_ptr<FabricMountingManager> mountingManager_;
   std::shared_ptr<Scheduler> scheduler_;
+  std::weak_ptr<RuntimeScheduler> runtimeScheduler_;
 
   std::shared_ptr<FabricMountingManager> verifyMountingManager(
       std::string const &locationHint);
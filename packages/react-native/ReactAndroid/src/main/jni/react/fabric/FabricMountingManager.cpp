@@ -258,7 +258,8 @@ local_ref<jobject> FabricMountingManager::getProps(
     newShadowView.props->propsDiffMapBuffer(&*oldShadowView.props, builder);
     return JReadableMapBuffer::createWithContents(builder.build());
   } else {
-    return ReadableNativeMap::newObjectCxxArgs(newShadowView.props->rawProps);
+    return ReadableNativeMap::newObjectCxxArgs(
+        newShadowView.props->rawProps.materialize());
   }
 }
 
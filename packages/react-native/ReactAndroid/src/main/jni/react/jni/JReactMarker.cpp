@@ -95,6 +95,12 @@ void JReactMarker::logPerfMarkerWithInstanceKey(
     case ReactMarker::REGISTER_JS_SEGMENT_STOP:
       JReactMarker::logMarker("REGISTER_JS_SEGMENT_STOP", tag, instanceKey);
       break;
+    case ReactMarker::NATIVE_REQUIRE_PREFETCH_HIT:
+      JReactMarker::logMarker("NATIVE_REQUIRE_PREFETCH_HIT", tag, instanceKey);
+      break;
+    case ReactMarker::NATIVE_REQUIRE_PREFETCH_MISS:
+      JReactMarker::logMarker("NATIVE_REQUIRE_PREFETCH_MISS", tag, instanceKey);
+      break;
     case ReactMarker::NATIVE_REQUIRE_START:
     case ReactMarker::NATIVE_REQUIRE_STOP:
     case ReactMarker::REACT_INSTANCE_INIT_START:
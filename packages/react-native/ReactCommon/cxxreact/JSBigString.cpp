@@ -16,6 +16,7 @@
 #include <folly/portability/SysStat.h>
 #include <folly/portability/Unistd.h>
 
+#include <algorithm>
 #include <memory>
 
 namespace facebook {
@@ -81,6 +82,34 @@ int JSBigFileString::fd() const {
   return m_fd;
 }
 
+void JSBigFileString::prefetch(size_t offset, size_t length) const {
+  advise(offset, length, MADV_WILLNEED);
+}
+
+void JSBigFileString::adviseRandomAccess(size_t offset, size_t length) const {
+  advise(offset, length, MADV_RANDOM);
+}
+
+void JSBigFileString::advise(size_t offset, size_t length, int advice) const {
+  auto data = c_str();
+  auto size = m_size - m_pageOff;
+  if (offset >= size || length == 0) {
+    return;
+  }
+  length = std::min(length, size - offset);
+
+  // madvise needs a page aligned address.
+  const static auto ps = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  auto begin = reinterpret_cast<uintptr_t>(data + offset);
+  auto alignedBegin = begin & ~(ps - 1);
+
+  // The advice is just a hint, failures don't matter.
+  madvise(
+      reinterpret_cast<void *>(alignedBegin),
+      length + (begin - alignedBegin),
+      advice);
+}
+
 std::unique_ptr<const JSBigFileString> JSBigFileString::fromPath(
     const std::string &sourceURL) {
   int fd = ::open(sourceURL.c_str(), O_RDONLY);
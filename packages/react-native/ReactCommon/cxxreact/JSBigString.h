@@ -9,6 +9,8 @@
 
 #include <folly/Exception.h>
 
+#include <memory>
+
 #ifndef RN_EXPORT
 #ifdef _MSC_VER
 #define RN_EXPORT
@@ -107,6 +109,36 @@ class RN_EXPORT JSBigBufferString : public JSBigString {
   size_t m_size;
 };
 
+// Concrete JSBigString implementation which refers to a part of another
+// JSBigString (e.g. the code of a module in a memory mapped bundle) and keeps
+// it alive, so that the part doesn't have to be copied.  The part has to be
+// followed by a \0 in the original string.
+class RN_EXPORT JSBigStringSlice : public JSBigString {
+ public:
+  JSBigStringSlice(
+      std::shared_ptr<const JSBigString> string,
+      const char *data,
+      size_t size)
+      : m_string(std::move(string)), m_data(data), m_size(size) {}
+
+  bool isAscii() const override {
+    return m_string->isAscii();
+  }
+
+  const char *c_str() const override {
+    return m_data;
+  }
+
+  size_t size() const override {
+    return m_size;
+  }
+
+ private:
+  std::shared_ptr<const JSBigString> m_string;
+  const char *m_data;
+  size_t m_size;
+};
+
 // JSBigString interface implemented by a file-backed mmap region.
 class RN_EXPORT JSBigFileString : public JSBigString {
  public:
@@ -122,10 +154,21 @@ class RN_EXPORT JSBigFileString : public JSBigString {
   size_t size() const override;
   int fd() const;
 
+  // Hint the OS that the given range of the data (relative to c_str()) is
+  // going to be needed soon, so that it's read ahead (MADV_WILLNEED).
+  void prefetch(size_t offset, size_t length) const;
+
+  // Hint the OS that the given range of the data (relative to c_str()) is
+  // going to be accessed in random order, so that pages around the accessed
+  // ones aren't read ahead (MADV_RANDOM).
+  void adviseRandomAccess(size_t offset, size_t length) const;
+
   static std::unique_ptr<const JSBigFileString> fromPath(
       const std::string &sourceURL);
 
  private:
+  void advise(size_t offset, size_t length, int advice) const;
+
   int m_fd; // The file descriptor being mmaped
   size_t m_size; // The size of the mmaped region
   mutable off_t m_pageOff; // The offset in the mmaped region to the data.
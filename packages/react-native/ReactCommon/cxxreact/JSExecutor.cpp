@@ -10,12 +10,22 @@
 #include "RAMBundleRegistry.h"
 
 #include <folly/Conv.h>
+#include <jsi/JSIDynamic.h>
 
 #include <chrono>
 
 namespace facebook {
 namespace react {
 
+void ExecutorDelegate::callNativeModules(
+    JSExecutor &executor,
+    jsi::Runtime &runtime,
+    const jsi::Value &calls,
+    bool isEndOfBatch) {
+  callNativeModules(
+      executor, jsi::dynamicFromValue(runtime, calls), isEndOfBatch);
+}
+
 std::string JSExecutor::getSyntheticBundlePath(
     uint32_t bundleId,
     const std::string &bundlePath) {
@@ -18,6 +18,11 @@
 #endif
 
 namespace facebook {
+namespace jsi {
+class Runtime;
+class Value;
+} // namespace jsi
+
 namespace react {
 
 class JSBigString;
@@ -39,6 +44,14 @@ class ExecutorDelegate {
       JSExecutor &executor,
       folly::dynamic &&calls,
       bool isEndOfBatch) = 0;
+  // Same as above, but takes the queue as a JSI value so that it can be
+  // decoded without converting it to folly::dynamic first. Must be called on
+  // the JS thread. Converts the queue and calls the overload above by default.
+  virtual void callNativeModules(
+      JSExecutor &executor,
+      jsi::Runtime &runtime,
+      const jsi::Value &calls,
+      bool isEndOfBatch);
   virtual MethodCallResult callSerializableNativeHook(
       JSExecutor &executor,
       unsigned int moduleId,
@@ -8,13 +8,17 @@
 #include "JSIndexedRAMBundle.h"
 
 #include <glog/logging.h>
-#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <ios>
 #include <memory>
-#include <sstream>
 
 namespace facebook {
 namespace react {
 
+// magic header, number of entries, and length of the startup section
+static constexpr size_t kHeaderSize = 3 * sizeof(uint32_t);
+
 std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
 JSIndexedRAMBundle::buildFactory() {
   return [](const std::string &bundlePath) {
@@ -23,108 +27,166 @@ JSIndexedRAMBundle::buildFactory() {
 }
 
 JSIndexedRAMBundle::JSIndexedRAMBundle(const char *sourcePath) {
-  m_bundle = std::make_unique<std::ifstream>(sourcePath, std::ifstream::binary);
-  if (!m_bundle) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Bundle ", sourcePath, "cannot be opened: ", m_bundle->rdstate()));
-  }
+  auto script = JSBigFileString::fromPath(sourcePath);
+  m_mappedScript = script.get();
+  m_script = std::move(script);
   init();
 }
 
 JSIndexedRAMBundle::JSIndexedRAMBundle(
-    std::unique_ptr<const JSBigString> script) {
-  // tmpStream is needed because m_bundle is std::istream type
-  // which has no member 'write'
-  std::unique_ptr<std::stringstream> tmpStream =
-      std::make_unique<std::stringstream>();
-  tmpStream->write(script->c_str(), script->size());
-  m_bundle = std::move(tmpStream);
-  if (!m_bundle) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Bundle from string cannot be opened: ", m_bundle->rdstate()));
-  }
+    std::unique_ptr<const JSBigString> script)
+    : m_script(std::move(script)) {
   init();
 }
 
 void JSIndexedRAMBundle::init() {
-  // read in magic header, number of entries, and length of the startup section
+  m_data = m_script->c_str();
+  m_size = m_script->size();
+
   uint32_t header[3];
   static_assert(
-      sizeof(header) == 12,
+      sizeof(header) == kHeaderSize,
       "header size must exactly match the input file format");
 
-  readBundle(reinterpret_cast<char *>(header), sizeof(header));
-  const size_t numTableEntries = folly::Endian::little(header[1]);
-  const size_t startupCodeSize = folly::Endian::little(header[2]);
+  readBundle(header, sizeof(header), 0);
+  m_numTableEntries = folly::Endian::little(header[1]);
+  m_startupCodeSize = folly::Endian::little(header[2]);
 
-  // allocate memory for meta data and lookup table.
-  m_table = ModuleTable(numTableEntries);
-  m_baseOffset = sizeof(header) + m_table.byteLength();
+  const uint64_t tableByteLength =
+      uint64_t{m_numTableEntries} * sizeof(ModuleData);
+  checkBounds(kHeaderSize, tableByteLength);
+  m_baseOffset = kHeaderSize + tableByteLength;
 
-  // read the lookup table from the file
-  readBundle(
-      reinterpret_cast<char *>(m_table.data.get()), m_table.byteLength());
-
-  // read the startup code
-  m_startupCode = std::unique_ptr<JSBigBufferString>(
-      new JSBigBufferString{startupCodeSize - 1});
-
-  readBundle(m_startupCode->data(), startupCodeSize - 1);
+  // the startup code is terminated with a \0 which isn't part of the code
+  if (m_startupCodeSize == 0) {
+    throw std::ios_base::failure("RAM Bundle has no startup code");
+  }
+  checkBounds(m_baseOffset, m_startupCodeSize);
+
+  if (m_mappedScript) {
+    // The startup code is evaluated right away, while modules are required
+    // one by one, in no particular order. Reading ahead around them would
+    // mostly page in code that isn't needed (yet).
+    const auto modulesOffset = m_baseOffset + m_startupCodeSize;
+    m_mappedScript->prefetch(0, modulesOffset);
+    m_mappedScript->adviseRandomAccess(modulesOffset, m_size - modulesOffset);
+  }
 }
 
 JSIndexedRAMBundle::Module JSIndexedRAMBundle::getModule(
     uint32_t moduleId) const {
+  auto range = getModuleCodeRange(moduleId);
   Module ret;
   ret.name = folly::to<std::string>(moduleId, ".js");
-  ret.code = getModuleCode(moduleId);
+  ret.code = std::string(m_data + range.first, range.second);
   return ret;
 }
 
+JSIndexedRAMBundle::BigStringModule JSIndexedRAMBundle::getBigStringModule(
+    uint32_t moduleId) const {
+  auto range = getModuleCodeRange(moduleId);
+  return {
+      folly::to<std::string>(moduleId, ".js"),
+      getSlice(range.first, range.second)};
+}
+
 std::unique_ptr<const JSBigString> JSIndexedRAMBundle::getStartupCode() {
-  CHECK(m_startupCode)
+  CHECK(!m_didGetStartupCode)
       << "startup code for a RAM Bundle can only be retrieved once";
-  return std::move(m_startupCode);
+  m_didGetStartupCode = true;
+  return getSlice(m_baseOffset, m_startupCodeSize - 1);
+}
+
+void JSIndexedRAMBundle::prefetchModules(
+    const std::vector<uint32_t> &moduleIds) const {
+  if (!m_mappedScript) {
+    return;
+  }
+
+  std::vector<std::pair<size_t, size_t>> ranges;
+  ranges.reserve(moduleIds.size());
+  for (auto moduleId : moduleIds) {
+    if (moduleId >= m_numTableEntries) {
+      continue;
+    }
+    ModuleData moduleData;
+    readBundle(
+        &moduleData,
+        sizeof(moduleData),
+        kHeaderSize + moduleId * sizeof(ModuleData));
+    const uint64_t offset =
+        m_baseOffset + folly::Endian::little(moduleData.offset);
+    const uint64_t length = folly::Endian::little(moduleData.length);
+    if (length == 0 || offset > m_size || length > m_size - offset) {
+      continue;
+    }
+    ranges.emplace_back(offset, offset + length);
+  }
+
+  // Modules required together are often next to each other in the bundle,
+  // so merging their ranges saves system calls.
+  std::sort(ranges.begin(), ranges.end());
+  size_t i = 0;
+  while (i < ranges.size()) {
+    auto begin = ranges[i].first;
+    auto end = ranges[i].second;
+    for (i++; i < ranges.size() && ranges[i].first <= end; i++) {
+      end = std::max(end, ranges[i].second);
+    }
+    m_mappedScript->prefetch(begin, end - begin);
+  }
 }
 
-std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
-  const auto moduleData = id < m_table.numEntries ? &m_table.data[id] : nullptr;
+std::pair<size_t, size_t> JSIndexedRAMBundle::getModuleCodeRange(
+    uint32_t id) const {
+  ModuleData moduleData{0, 0};
+  if (id < m_numTableEntries) {
+    readBundle(
+        &moduleData,
+        sizeof(moduleData),
+        kHeaderSize + id * sizeof(ModuleData));
+  }
 
   // entries without associated code have offset = 0 and length = 0
-  const uint32_t length =
-      moduleData ? folly::Endian::little(moduleData->length) : 0;
+  const uint32_t length = folly::Endian::little(moduleData.length);
   if (length == 0) {
     throw std::ios_base::failure(
         folly::to<std::string>("Error loading module", id, "from RAM Bundle"));
   }
 
-  std::string ret(length - 1, '\0');
-  readBundle(
-      &ret.front(),
-      length - 1,
-      m_baseOffset + folly::Endian::little(moduleData->offset));
-  return ret;
+  const uint64_t offset =
+      m_baseOffset + folly::Endian::little(moduleData.offset);
+  checkBounds(offset, length);
+  return {offset, length - 1};
 }
 
-void JSIndexedRAMBundle::readBundle(char *buffer, const std::streamsize bytes)
-    const {
-  if (!m_bundle->read(buffer, bytes)) {
-    if (m_bundle->rdstate() & std::ios::eofbit) {
-      throw std::ios_base::failure("Unexpected end of RAM Bundle file");
-    }
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Error reading RAM Bundle: ", m_bundle->rdstate()));
+std::unique_ptr<const JSBigString> JSIndexedRAMBundle::getSlice(
+    size_t offset,
+    size_t length) const {
+  // JSBigString has to be \0 terminated, which is the case for well formed
+  // bundles; the code is copied otherwise.
+  if (m_data[offset + length] != '\0') {
+    auto copy = std::make_unique<JSBigBufferString>(length);
+    std::memcpy(copy->data(), m_data + offset, length);
+    return copy;
   }
+  return std::make_unique<JSBigStringSlice>(
+      m_script, m_data + offset, length);
 }
 
 void JSIndexedRAMBundle::readBundle(
-    char *buffer,
-    const std::streamsize bytes,
-    const std::ifstream::pos_type position) const {
-  if (!m_bundle->seekg(position)) {
-    throw std::ios_base::failure(folly::to<std::string>(
-        "Error reading RAM Bundle: ", m_bundle->rdstate()));
+    void *buffer,
+    size_t bytes,
+    size_t position) const {
+  checkBounds(position, bytes);
+  std::memcpy(buffer, m_data + position, bytes);
+}
+
+void JSIndexedRAMBundle::checkBounds(uint64_t position, uint64_t bytes)
+    const {
+  if (position > m_size || bytes > m_size - position) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
   }
-  readBundle(buffer, bytes);
 }
 
 } // namespace react
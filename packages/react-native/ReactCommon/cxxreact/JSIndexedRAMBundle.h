@@ -7,8 +7,9 @@
 
 #pragma once
 
-#include <istream>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSModulesUnbundle.h>
@@ -20,6 +21,10 @@
 namespace facebook {
 namespace react {
 
+// Reads indexed RAM bundles (a header, a table of module offsets and lengths,
+// the startup code and the code of all modules) in place: bundle files are
+// memory mapped, and the startup code and code of modules are returned as
+// views into the bundle without copying.
 class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
  public:
   static std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
@@ -33,6 +38,14 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
   std::unique_ptr<const JSBigString> getStartupCode();
   // Throws std::runtime_error on failure.
   Module getModule(uint32_t moduleId) const override;
+  // Throws std::runtime_error on failure.
+  BigStringModule getBigStringModule(uint32_t moduleId) const override;
+
+  // Hints the OS to read the code of the given modules ahead, so that
+  // requiring them later doesn't block on page faults. Does nothing if the
+  // bundle isn't memory mapped.
+  void prefetchModules(
+      const std::vector<uint32_t> &moduleIds) const override;
 
  private:
   struct ModuleData {
@@ -43,30 +56,24 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
       sizeof(ModuleData) == 8,
       "ModuleData must not have any padding and use sizes matching input files");
 
-  struct ModuleTable {
-    size_t numEntries;
-    std::unique_ptr<ModuleData[]> data;
-    ModuleTable() : numEntries(0){};
-    ModuleTable(size_t entries)
-        : numEntries(entries),
-          data(std::unique_ptr<ModuleData[]>(new ModuleData[numEntries])){};
-    size_t byteLength() const {
-      return numEntries * sizeof(ModuleData);
-    }
-  };
-
   void init();
-  std::string getModuleCode(const uint32_t id) const;
-  void readBundle(char *buffer, const std::streamsize bytes) const;
-  void readBundle(
-      char *buffer,
-      const std::streamsize bytes,
-      const std::istream::pos_type position) const;
+  // Returns the offset of the module's code from the beginning of the bundle
+  // and its length (without the trailing \0).
+  std::pair<size_t, size_t> getModuleCodeRange(uint32_t id) const;
+  std::unique_ptr<const JSBigString> getSlice(size_t offset, size_t length)
+      const;
+  void readBundle(void *buffer, size_t bytes, size_t position) const;
+  void checkBounds(uint64_t position, uint64_t bytes) const;
 
-  mutable std::unique_ptr<std::istream> m_bundle;
-  ModuleTable m_table;
-  size_t m_baseOffset;
-  std::unique_ptr<JSBigBufferString> m_startupCode;
+  std::shared_ptr<const JSBigString> m_script;
+  // Set if the bundle is memory mapped.
+  const JSBigFileString *m_mappedScript{nullptr};
+  const char *m_data{nullptr};
+  size_t m_size{0};
+  size_t m_numTableEntries{0};
+  size_t m_baseOffset{0};
+  size_t m_startupCodeSize{0};
+  bool m_didGetStartupCode{false};
 };
 
 } // namespace react
@@ -8,9 +8,12 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include <cxxreact/JSBigString.h>
 #include <folly/Conv.h>
 
 namespace facebook {
@@ -36,10 +39,33 @@ class JSModulesUnbundle {
     std::string name;
     std::string code;
   };
+  struct BigStringModule {
+    std::string name;
+    std::unique_ptr<const JSBigString> code;
+  };
   JSModulesUnbundle() {}
   virtual ~JSModulesUnbundle() {}
   virtual Module getModule(uint32_t moduleId) const = 0;
 
+  /**
+   * Same as getModule, but returns the code as a JSBigString, so that
+   * implementations which have it in memory already (e.g. memory mapped) can
+   * return it without copying. Wraps the result of getModule by default.
+   */
+  virtual BigStringModule getBigStringModule(uint32_t moduleId) const {
+    auto module = getModule(moduleId);
+    return {
+        std::move(module.name),
+        std::make_unique<JSBigStdString>(std::move(module.code))};
+  }
+
+  /**
+   * Hints that the given modules are going to be required soon, so that
+   * implementations can start reading them ahead. Does nothing by default.
+   */
+  virtual void prefetchModules(const std::vector<uint32_t> & /*moduleIds*/)
+      const {}
+
  private:
   JSModulesUnbundle(const JSModulesUnbundle &) = delete;
 };
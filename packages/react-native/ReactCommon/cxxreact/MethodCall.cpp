@@ -8,6 +8,7 @@
 #include "MethodCall.h"
 
 #include <folly/json.h>
+#include <jsi/JSIDynamic.h>
 #include <stdexcept>
 
 namespace facebook {
@@ -85,5 +86,98 @@ std::vector<MethodCall> parseMethodCalls(folly::dynamic &&jsonData) {
   return methodCalls;
 }
 
+static bool isArray(jsi::Runtime &runtime, const jsi::Value &value) {
+  return value.isObject() && value.getObject(runtime).isArray(runtime);
+}
+
+// Ids are converted the same way as by the folly::dynamic overload, which is
+// cheap for numbers; other values are only converted to fail the same way.
+static int64_t asInt(jsi::Runtime &runtime, const jsi::Value &value) {
+  return jsi::dynamicFromValue(runtime, value).asInt();
+}
+
+static const char *typeName(jsi::Runtime &runtime, const jsi::Value &value) {
+  return jsi::dynamicFromValue(runtime, value).typeName();
+}
+
+std::vector<MethodCall> parseMethodCalls(
+    jsi::Runtime &runtime,
+    const jsi::Value &calls) {
+  if (calls.isNull()) {
+    return {};
+  }
+
+  if (!isArray(runtime, calls)) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix, "input isn't array but ", typeName(runtime, calls)));
+  }
+
+  auto queue = calls.getObject(runtime).getArray(runtime);
+  auto size = queue.size(runtime);
+
+  if (size < REQUEST_PARAMSS + 1) {
+    throw std::invalid_argument(
+        folly::to<std::string>(errorPrefix, "size == ", size));
+  }
+
+  auto moduleIdsValue = queue.getValueAtIndex(runtime, REQUEST_MODULE_IDS);
+  auto methodIdsValue = queue.getValueAtIndex(runtime, REQUEST_METHOD_IDS);
+  auto paramsValue = queue.getValueAtIndex(runtime, REQUEST_PARAMSS);
+  int callId = -1;
+
+  if (!isArray(runtime, moduleIdsValue) || !isArray(runtime, methodIdsValue) ||
+      !isArray(runtime, paramsValue)) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix,
+        "not all fields are arrays.\n\n",
+        folly::toJson(jsi::dynamicFromValue(runtime, calls))));
+  }
+
+  auto moduleIds = moduleIdsValue.getObject(runtime).getArray(runtime);
+  auto methodIds = methodIdsValue.getObject(runtime).getArray(runtime);
+  auto params = paramsValue.getObject(runtime).getArray(runtime);
+
+  if (moduleIds.size(runtime) != methodIds.size(runtime) ||
+      moduleIds.size(runtime) != params.size(runtime)) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix,
+        "field sizes are different.\n\n",
+        folly::toJson(jsi::dynamicFromValue(runtime, calls))));
+  }
+
+  if (size > REQUEST_CALLID) {
+    auto callIdValue = queue.getValueAtIndex(runtime, REQUEST_CALLID);
+    if (!callIdValue.isNumber()) {
+      throw std::invalid_argument(folly::to<std::string>(
+          errorPrefix, "invalid callId", typeName(runtime, callIdValue)));
+    }
+    callId = (int)asInt(runtime, callIdValue);
+  }
+
+  auto numberOfCalls = moduleIds.size(runtime);
+  std::vector<MethodCall> methodCalls;
+  methodCalls.reserve(numberOfCalls);
+  for (size_t i = 0; i < numberOfCalls; i++) {
+    auto arguments = params.getValueAtIndex(runtime, i);
+    if (!isArray(runtime, arguments)) {
+      throw std::invalid_argument(folly::to<std::string>(
+          errorPrefix,
+          "method arguments isn't array but ",
+          typeName(runtime, arguments)));
+    }
+
+    methodCalls.emplace_back(
+        static_cast<int>(asInt(runtime, moduleIds.getValueAtIndex(runtime, i))),
+        static_cast<int>(asInt(runtime, methodIds.getValueAtIndex(runtime, i))),
+        jsi::dynamicFromValue(runtime, arguments),
+        callId);
+
+    // only increment callid if contains valid callid as callid is optional
+    callId += (callId != -1) ? 1 : 0;
+  }
+
+  return methodCalls;
+}
+
 } // namespace react
 } // namespace facebook
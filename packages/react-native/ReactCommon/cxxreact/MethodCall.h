@@ -14,6 +14,11 @@
 #include <folly/dynamic.h>
 
 namespace facebook {
+namespace jsi {
+class Runtime;
+class Value;
+} // namespace jsi
+
 namespace react {
 
 struct MethodCall {
@@ -32,5 +37,13 @@ struct MethodCall {
 /// \throws std::invalid_argument
 std::vector<MethodCall> parseMethodCalls(folly::dynamic &&calls);
 
+/// Same as above, but decodes the message queue flushed by JS directly from
+/// JSI, without converting the whole queue to folly::dynamic first. Must be
+/// called on the JS thread.
+/// \throws std::invalid_argument
+std::vector<MethodCall> parseMethodCalls(
+    jsi::Runtime &runtime,
+    const jsi::Value &calls);
+
 } // namespace react
 } // namespace facebook
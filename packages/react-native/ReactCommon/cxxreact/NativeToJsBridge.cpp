@@ -60,7 +60,40 @@ class JsToNativeBridge : public react::ExecutorDelegate {
     m_batchHadNativeModuleOrTurboModuleCalls =
         m_batchHadNativeModuleOrTurboModuleCalls || !calls.empty();
 
-    std::vector<MethodCall> methodCalls = parseMethodCalls(std::move(calls));
+    dispatchMethodCalls(parseMethodCalls(std::move(calls)), isEndOfBatch);
+  }
+
+  void callNativeModules(
+      [[maybe_unused]] JSExecutor &executor,
+      jsi::Runtime &runtime,
+      const jsi::Value &calls,
+      bool isEndOfBatch) override {
+    std::vector<MethodCall> methodCalls = parseMethodCalls(runtime, calls);
+    CHECK(m_registry || methodCalls.empty())
+        << "native module calls cannot be completed with no native modules";
+    m_batchHadNativeModuleOrTurboModuleCalls =
+        m_batchHadNativeModuleOrTurboModuleCalls || !methodCalls.empty();
+
+    dispatchMethodCalls(std::move(methodCalls), isEndOfBatch);
+  }
+
+  MethodCallResult callSerializableNativeHook(
+      [[maybe_unused]] JSExecutor &executor,
+      unsigned int moduleId,
+      unsigned int methodId,
+      folly::dynamic &&args) override {
+    return m_registry->callSerializableNativeHook(
+        moduleId, methodId, std::move(args));
+  }
+
+  void recordTurboModuleAsyncMethodCall() {
+    m_batchHadNativeModuleOrTurboModuleCalls = true;
+  }
+
+ private:
+  void dispatchMethodCalls(
+      std::vector<MethodCall> &&methodCalls,
+      bool isEndOfBatch) {
     BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessEnd(
         (int)methodCalls.size());
 
@@ -84,20 +117,6 @@ class JsToNativeBridge : public react::ExecutorDelegate {
     }
   }
 
-  MethodCallResult callSerializableNativeHook(
-      [[maybe_unused]] JSExecutor &executor,
-      unsigned int moduleId,
-      unsigned int methodId,
-      folly::dynamic &&args) override {
-    return m_registry->callSerializableNativeHook(
-        moduleId, methodId, std::move(args));
-  }
-
-  void recordTurboModuleAsyncMethodCall() {
-    m_batchHadNativeModuleOrTurboModuleCalls = true;
-  }
-
- private:
   // These methods are always invoked from an Executor.  The NativeToJsBridge
   // keeps a reference to the executor, and when destroy() is called, the
   // executor is destroyed synchronously on its queue.
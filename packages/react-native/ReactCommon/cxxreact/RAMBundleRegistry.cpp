@@ -7,15 +7,57 @@
 
 #include "RAMBundleRegistry.h"
 
+#include <cxxreact/ReactMarker.h>
 #include <folly/String.h>
 
+#include <fstream>
+#include <map>
 #include <memory>
+#include <optional>
 
 namespace facebook {
 namespace react {
 
 constexpr uint32_t RAMBundleRegistry::MAIN_BUNDLE_ID;
 
+static uint64_t moduleKey(uint32_t bundleId, uint32_t moduleId) {
+  return (static_cast<uint64_t>(bundleId) << 32) | moduleId;
+}
+
+// Traces are text files with the bundle and module id of a module per line.
+static std::vector<std::pair<uint32_t, uint32_t>> readStartupTrace(
+    const std::string &tracePath) {
+  std::vector<std::pair<uint32_t, uint32_t>> trace;
+  std::ifstream file(tracePath);
+  uint32_t bundleId;
+  uint32_t moduleId;
+  while (file >> bundleId >> moduleId) {
+    trace.emplace_back(bundleId, moduleId);
+  }
+  return trace;
+}
+
+static void writeStartupTrace(
+    const std::string &tracePath,
+    const std::vector<std::pair<uint32_t, uint32_t>> &trace) {
+  std::ofstream file(tracePath, std::ios::trunc);
+  for (const auto &entry : trace) {
+    file << entry.first << ' ' << entry.second << '\n';
+  }
+}
+
+// Makes sure the code is in memory (e.g. if the bundle is memory mapped), so
+// that evaluating it on the JS thread doesn't block on I/O.
+static void touchPages(const JSBigString &code) {
+  constexpr size_t kPageSize = 4096;
+  const volatile char *data = code.c_str();
+  char sink = 0;
+  for (size_t i = 0; i < code.size(); i += kPageSize) {
+    sink ^= data[i];
+  }
+  (void)sink;
+}
+
 std::unique_ptr<RAMBundleRegistry> RAMBundleRegistry::singleBundleRegistry(
     std::unique_ptr<JSModulesUnbundle> mainBundle) {
   return std::make_unique<RAMBundleRegistry>(std::move(mainBundle));
@@ -35,15 +77,150 @@ RAMBundleRegistry::RAMBundleRegistry(
   m_bundles.emplace(MAIN_BUNDLE_ID, std::move(mainBundle));
 }
 
+RAMBundleRegistry::~RAMBundleRegistry() {
+  m_shouldStopPrefetching = true;
+  if (m_prefetchThread.joinable()) {
+    m_prefetchThread.join();
+  }
+  if (m_traceWriterThread.joinable()) {
+    m_traceWriterThread.join();
+  }
+
+  // The registry is destroyed with the executor, once JS doesn't run anymore,
+  // so a trace which is still being recorded can be written right here.
+  if (!m_tracePath.empty()) {
+    writeStartupTrace(m_tracePath, m_trace);
+  }
+}
+
 void RAMBundleRegistry::registerBundle(
     uint32_t bundleId,
     std::string bundlePath) {
+  std::lock_guard<std::mutex> lock(m_mutex);
   m_bundlePaths.emplace(bundleId, std::move(bundlePath));
 }
 
 JSModulesUnbundle::Module RAMBundleRegistry::getModule(
     uint32_t bundleId,
     uint32_t moduleId) {
+  auto module = [&] {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return getOrLoadBundle(bundleId)->getModule(moduleId);
+  }();
+  module.name = getModuleName(bundleId, std::move(module.name));
+  didRequireModule(bundleId, moduleId, module.name);
+  return module;
+}
+
+JSModulesUnbundle::BigStringModule RAMBundleRegistry::getBigStringModule(
+    uint32_t bundleId,
+    uint32_t moduleId) {
+  auto module = [&] {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return getOrLoadBundle(bundleId)->getBigStringModule(moduleId);
+  }();
+  module.name = getModuleName(bundleId, std::move(module.name));
+  didRequireModule(bundleId, moduleId, module.name);
+  return module;
+}
+
+void RAMBundleRegistry::recordStartupTrace(
+    std::string tracePath,
+    std::chrono::milliseconds duration) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_tracePath = std::move(tracePath);
+  m_traceDeadline = std::chrono::steady_clock::now() + duration;
+  m_trace.clear();
+  m_tracedModules.clear();
+}
+
+void RAMBundleRegistry::prefetchStartupTrace(
+    const std::string &tracePath,
+    ModuleLoadedCallback onModuleLoaded) {
+  auto trace = readStartupTrace(tracePath);
+  if (trace.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isPrefetching) {
+      return;
+    }
+    m_isPrefetching = true;
+  }
+
+  m_prefetchThread = std::thread(
+      &RAMBundleRegistry::prefetchModules,
+      this,
+      std::move(trace),
+      std::move(onModuleLoaded));
+}
+
+void RAMBundleRegistry::prefetchModules(
+    std::vector<std::pair<uint32_t, uint32_t>> trace,
+    ModuleLoadedCallback onModuleLoaded) {
+  // Must be called with m_mutex held.
+  auto tryGetBundle = [this](uint32_t bundleId) -> JSModulesUnbundle * {
+    try {
+      return getOrLoadBundle(bundleId);
+    } catch (const std::exception &) {
+      // The bundle isn't registered (yet).
+      return nullptr;
+    }
+  };
+
+  // Letting the OS read all of the modules ahead first...
+  std::map<uint32_t, std::vector<uint32_t>> moduleIdsByBundleId;
+  for (const auto &entry : trace) {
+    moduleIdsByBundleId[entry.first].push_back(entry.second);
+  }
+  for (const auto &entry : moduleIdsByBundleId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (auto bundle = tryGetBundle(entry.first)) {
+      bundle->prefetchModules(entry.second);
+    }
+  }
+
+  // ...then loading them in the order they're going to be required.
+  for (const auto &entry : trace) {
+    if (m_shouldStopPrefetching) {
+      return;
+    }
+
+    try {
+      // Bundles aren't thread safe, so this blocks JS from requiring a module
+      // for as long as it takes to read one module. The pages are then
+      // touched without holding the lock.
+      auto module = [&]() -> std::optional<JSModulesUnbundle::BigStringModule> {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto bundle = tryGetBundle(entry.first);
+        if (!bundle) {
+          return std::nullopt;
+        }
+        return bundle->getBigStringModule(entry.second);
+      }();
+      if (!module) {
+        continue;
+      }
+
+      touchPages(*module->code);
+      if (onModuleLoaded) {
+        module->name = getModuleName(entry.first, std::move(module->name));
+        onModuleLoaded(entry.first, entry.second, *module);
+      }
+    } catch (const std::exception &) {
+      // The trace is outdated, JS will report the error if it requires the
+      // module anyway.
+      continue;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_prefetchedModules.insert(moduleKey(entry.first, entry.second));
+  }
+}
+
+JSModulesUnbundle *RAMBundleRegistry::getOrLoadBundle(uint32_t bundleId) {
   if (m_bundles.find(bundleId) == m_bundles.end()) {
     if (!m_factory) {
       throw std::runtime_error(
@@ -59,15 +236,59 @@ JSModulesUnbundle::Module RAMBundleRegistry::getModule(
     }
     m_bundles.emplace(bundleId, m_factory(bundlePath->second));
   }
+  return getBundle(bundleId);
+}
 
-  auto module = getBundle(bundleId)->getModule(moduleId);
+std::string RAMBundleRegistry::getModuleName(
+    uint32_t bundleId,
+    std::string name) {
   if (bundleId == MAIN_BUNDLE_ID) {
-    return module;
+    return name;
+  }
+  return folly::to<std::string>("seg-", bundleId, '_', std::move(name));
+}
+
+void RAMBundleRegistry::didRequireModule(
+    uint32_t bundleId,
+    uint32_t moduleId,
+    const std::string &moduleName) {
+  auto key = moduleKey(bundleId, moduleId);
+  bool isPrefetching;
+  bool wasPrefetched;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_tracePath.empty()) {
+      if (std::chrono::steady_clock::now() < m_traceDeadline) {
+        if (m_tracedModules.insert(key).second) {
+          m_trace.emplace_back(bundleId, moduleId);
+        }
+      } else {
+        // Modules are required on the JS thread, which shouldn't wait for
+        // the file to be written.
+        if (m_traceWriterThread.joinable()) {
+          // Only if the trace was recorded more than once.
+          m_traceWriterThread.join();
+        }
+        m_traceWriterThread = std::thread(
+            [tracePath = std::move(m_tracePath), trace = std::move(m_trace)] {
+              writeStartupTrace(tracePath, trace);
+            });
+        m_tracePath.clear();
+        m_trace.clear();
+        m_tracedModules.clear();
+      }
+    }
+    isPrefetching = m_isPrefetching;
+    wasPrefetched = m_prefetchedModules.count(key) > 0;
+  }
+
+  bool hasLogger(ReactMarker::logTaggedMarkerImpl);
+  if (isPrefetching && hasLogger) {
+    ReactMarker::logTaggedMarker(
+        wasPrefetched ? ReactMarker::NATIVE_REQUIRE_PREFETCH_HIT
+                      : ReactMarker::NATIVE_REQUIRE_PREFETCH_MISS,
+        moduleName.c_str());
   }
-  return {
-      folly::to<std::string>("seg-", bundleId, '_', std::move(module.name)),
-      std::move(module.code),
-  };
 }
 
 JSModulesUnbundle *RAMBundleRegistry::getBundle(uint32_t bundleId) const {
@@ -7,11 +7,18 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <cxxreact/JSModulesUnbundle.h>
 
@@ -26,6 +33,11 @@ class RN_EXPORT RAMBundleRegistry {
  public:
   constexpr static uint32_t MAIN_BUNDLE_ID = 0;
 
+  using ModuleLoadedCallback = std::function<void(
+      uint32_t bundleId,
+      uint32_t moduleId,
+      const JSModulesUnbundle::BigStringModule &module)>;
+
   static std::unique_ptr<RAMBundleRegistry> singleBundleRegistry(
       std::unique_ptr<JSModulesUnbundle> mainBundle);
   static std::unique_ptr<RAMBundleRegistry> multipleBundlesRegistry(
@@ -37,19 +49,71 @@ class RN_EXPORT RAMBundleRegistry {
       std::function<std::unique_ptr<JSModulesUnbundle>(std::string)> factory =
           nullptr);
 
-  RAMBundleRegistry(RAMBundleRegistry &&) = default;
-  RAMBundleRegistry &operator=(RAMBundleRegistry &&) = default;
+  RAMBundleRegistry(const RAMBundleRegistry &) = delete;
+  RAMBundleRegistry &operator=(const RAMBundleRegistry &) = delete;
 
   void registerBundle(uint32_t bundleId, std::string bundlePath);
   JSModulesUnbundle::Module getModule(uint32_t bundleId, uint32_t moduleId);
-  virtual ~RAMBundleRegistry(){};
+  JSModulesUnbundle::BigStringModule getBigStringModule(
+      uint32_t bundleId,
+      uint32_t moduleId);
+
+  // Startup traces are opt-in: hosts enable them by calling the methods below
+  // before handing the registry to Instance::loadRAMBundle.
+
+  // Records which modules get required (in order) during the given duration,
+  // and writes them to tracePath once it's over (on a background thread) or
+  // when the registry is destroyed, whichever comes first.
+  void recordStartupTrace(
+      std::string tracePath,
+      std::chrono::milliseconds duration);
+
+  // Loads the modules listed in a trace written by recordStartupTrace (e.g.
+  // during the previous launch) on a background thread, before JS requires
+  // them. onModuleLoaded is called on that thread with the code of each of
+  // the modules, which allows to also precompile them (e.g. with
+  // jsi::Runtime::prepareJavaScript, if the runtime supports calling it off
+  // the JS thread).
+  // From now on, every module required is reported to ReactMarker as a
+  // NATIVE_REQUIRE_PREFETCH_HIT or NATIVE_REQUIRE_PREFETCH_MISS, tagged with
+  // the name of the module.
+  void prefetchStartupTrace(
+      const std::string &tracePath,
+      ModuleLoadedCallback onModuleLoaded = nullptr);
+
+  virtual ~RAMBundleRegistry();
 
  private:
   JSModulesUnbundle *getBundle(uint32_t bundleId) const;
+  // Must be called with m_mutex held.
+  JSModulesUnbundle *getOrLoadBundle(uint32_t bundleId);
+  static std::string getModuleName(uint32_t bundleId, std::string name);
+  void didRequireModule(
+      uint32_t bundleId,
+      uint32_t moduleId,
+      const std::string &moduleName);
+  void prefetchModules(
+      std::vector<std::pair<uint32_t, uint32_t>> trace,
+      ModuleLoadedCallback onModuleLoaded);
 
   std::function<std::unique_ptr<JSModulesUnbundle>(std::string)> m_factory;
   std::unordered_map<uint32_t, std::string> m_bundlePaths;
   std::unordered_map<uint32_t, std::unique_ptr<JSModulesUnbundle>> m_bundles;
+
+  // Guards everything above and below. Bundles aren't thread safe and are
+  // also read from the prefetch thread, so it's held while reading a module.
+  mutable std::mutex m_mutex;
+
+  std::string m_tracePath;
+  std::chrono::steady_clock::time_point m_traceDeadline;
+  std::vector<std::pair<uint32_t, uint32_t>> m_trace;
+  std::unordered_set<uint64_t> m_tracedModules;
+  std::thread m_traceWriterThread;
+
+  bool m_isPrefetching{false};
+  std::unordered_set<uint64_t> m_prefetchedModules;
+  std::atomic<bool> m_shouldStopPrefetching{false};
+  std::thread m_prefetchThread;
 };
 
 } // namespace react
@@ -28,7 +28,9 @@ enum ReactMarkerId {
   REGISTER_JS_SEGMENT_START,
   REGISTER_JS_SEGMENT_STOP,
   REACT_INSTANCE_INIT_START,
-  REACT_INSTANCE_INIT_STOP
+  REACT_INSTANCE_INIT_STOP,
+  NATIVE_REQUIRE_PREFETCH_HIT,
+  NATIVE_REQUIRE_PREFETCH_MISS
 };
 
 #ifdef __APPLE__
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/MethodCall.h>
+#include <folly/Conv.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+
+namespace facebook::react {
+
+/*
+ * Returns a message queue (as flushed by `MessageQueue.js`) with the given
+ * number of calls, with arguments typical of chatty legacy modules.
+ */
+static jsi::Value createQueue(jsi::Runtime &runtime, int64_t numberOfCalls) {
+  auto moduleIds = jsi::Array(runtime, numberOfCalls);
+  auto methodIds = jsi::Array(runtime, numberOfCalls);
+  auto params = jsi::Array(runtime, numberOfCalls);
+  for (int64_t i = 0; i < numberOfCalls; i++) {
+    auto point = jsi::Object(runtime);
+    point.setProperty(runtime, "x", static_cast<double>(i));
+    point.setProperty(runtime, "y", static_cast<double>(2 * i));
+    point.setProperty(
+        runtime,
+        "tags",
+        jsi::Array::createWithElements(
+            runtime,
+            jsi::String::createFromAscii(runtime, "a"),
+            jsi::String::createFromAscii(runtime, "b")));
+
+    moduleIds.setValueAtIndex(runtime, i, static_cast<double>(i % 17));
+    methodIds.setValueAtIndex(runtime, i, static_cast<double>(i % 5));
+    params.setValueAtIndex(
+        runtime,
+        i,
+        jsi::Array::createWithElements(
+            runtime,
+            static_cast<double>(i),
+            jsi::String::createFromUtf8(
+                runtime, folly::to<std::string>("e", i)),
+            std::move(point),
+            7));
+  }
+  return jsi::Array::createWithElements(
+      runtime,
+      std::move(moduleIds),
+      std::move(methodIds),
+      std::move(params),
+      1000);
+}
+
+/*
+ * The whole queue is converted to folly::dynamic and then moved into
+ * MethodCall objects.
+ */
+static void dynamicFromValueAndParseMethodCalls(benchmark::State &state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto queue = createQueue(*runtime, state.range(0));
+
+  for (auto _ : state) {
+    auto methodCalls = parseMethodCalls(jsi::dynamicFromValue(*runtime, queue));
+    benchmark::DoNotOptimize(methodCalls);
+  }
+}
+BENCHMARK(dynamicFromValueAndParseMethodCalls)->Arg(10)->Arg(100)->Arg(1000);
+
+/*
+ * MethodCall objects are decoded directly from the queue.
+ */
+static void parseMethodCallsFromValue(benchmark::State &state) {
+  auto runtime = hermes::makeHermesRuntime();
+  auto queue = createQueue(*runtime, state.range(0));
+
+  for (auto _ : state) {
+    auto methodCalls = parseMethodCalls(*runtime, queue);
+    benchmark::DoNotOptimize(methodCalls);
+  }
+}
+BENCHMARK(parseMethodCallsFromValue)->Arg(10)->Arg(100)->Arg(1000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
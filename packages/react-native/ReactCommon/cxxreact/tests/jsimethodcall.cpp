@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cxxreact/MethodCall.h>
+
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include <gtest/gtest.h>
+#pragma GCC diagnostic pop
+
+using namespace facebook;
+using namespace facebook::react;
+
+class JSIMethodCallTest : public ::testing::Test {
+ protected:
+  JSIMethodCallTest() : runtime_(hermes::makeHermesRuntime()) {}
+
+  jsi::Value evaluate(const std::string &jsText) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>("(" + jsText + ")"), "");
+  }
+
+  /*
+   * Checks that both overloads of `parseMethodCalls` agree on the queue.
+   */
+  void expectSameMethodCalls(const std::string &jsText) {
+    auto queue = evaluate(jsText);
+    auto methodCalls = parseMethodCalls(*runtime_, queue);
+    auto expectedMethodCalls =
+        parseMethodCalls(jsi::dynamicFromValue(*runtime_, queue));
+
+    ASSERT_EQ(expectedMethodCalls.size(), methodCalls.size()) << jsText;
+    for (size_t i = 0; i < methodCalls.size(); i++) {
+      EXPECT_EQ(expectedMethodCalls[i].moduleId, methodCalls[i].moduleId);
+      EXPECT_EQ(expectedMethodCalls[i].methodId, methodCalls[i].methodId);
+      EXPECT_EQ(expectedMethodCalls[i].arguments, methodCalls[i].arguments);
+      EXPECT_EQ(expectedMethodCalls[i].callId, methodCalls[i].callId);
+    }
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+};
+
+TEST_F(JSIMethodCallTest, NullQueue) {
+  EXPECT_TRUE(parseMethodCalls(*runtime_, jsi::Value::null()).empty());
+}
+
+TEST_F(JSIMethodCallTest, MatchesDynamicParsing) {
+  expectSameMethodCalls(
+      "[[7,0,3],[3,1,2],[[],[\"foo\",14,null,false],"
+      "[{\"foo\":\"hello\",\"bar\":[4.5,true]}]],42]");
+  expectSameMethodCalls("[[0,0],[1,1],[[],[]]]");
+  expectSameMethodCalls("[[],[],[]]");
+}
+
+TEST_F(JSIMethodCallTest, IdsAreConvertedLikeDynamicParsing) {
+  expectSameMethodCalls("[[\"7\",true],[3,\"1\"],[[],[]]]");
+}
+
+TEST_F(JSIMethodCallTest, InvalidQueueFormat) {
+  auto invalidQueues = {
+      "{\"foo\": 1}",
+      "[{\"foo\": 1}]",
+      "[1, 4, {\"foo\": 2}]",
+      "[[1], [4], {\"foo\": 2}]",
+      "[[1], [4], []]",
+      "[[1], [4], [[]], \"42\"]",
+      "[[1, 2], [4, 5], [[], 42]]",
+  };
+  for (auto jsText : invalidQueues) {
+    auto queue = evaluate(jsText);
+    auto expectedMessage = std::string{};
+    try {
+      parseMethodCalls(jsi::dynamicFromValue(*runtime_, queue));
+    } catch (const std::invalid_argument &e) {
+      expectedMessage = e.what();
+    }
+
+    try {
+      parseMethodCalls(*runtime_, queue);
+      ADD_FAILURE() << "No exception thrown for " << jsText;
+    } catch (const std::invalid_argument &e) {
+      EXPECT_EQ(expectedMessage, e.what()) << jsText;
+    }
+  }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <ios>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cxxreact/JSIndexedRAMBundle.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+
+namespace {
+// Builds an indexed RAM bundle; modules with empty code have no table entry.
+std::string makeBundle(
+    const std::string &startupCode,
+    const std::vector<std::string> &modules) {
+  std::vector<uint32_t> header{0xFB0BD1E5, 0, 0};
+  header[1] = modules.size();
+  header[2] = startupCode.size() + 1;
+
+  std::vector<uint32_t> table;
+  std::string code = startupCode + '\0';
+  for (const auto &module : modules) {
+    if (module.empty()) {
+      table.push_back(0);
+      table.push_back(0);
+      continue;
+    }
+    table.push_back(code.size());
+    table.push_back(module.size() + 1);
+    code += module + '\0';
+  }
+
+  std::string bundle;
+  bundle.append(
+      reinterpret_cast<const char *>(header.data()),
+      header.size() * sizeof(uint32_t));
+  bundle.append(
+      reinterpret_cast<const char *>(table.data()),
+      table.size() * sizeof(uint32_t));
+  return bundle + code;
+}
+
+std::unique_ptr<JSIndexedRAMBundle> bundleFromString(std::string bundle) {
+  return std::make_unique<JSIndexedRAMBundle>(
+      std::make_unique<JSBigStdString>(std::move(bundle)));
+}
+
+std::string toString(const JSBigString &string) {
+  return std::string(string.c_str(), string.size());
+}
+} // namespace
+
+TEST(JSIndexedRAMBundle, StartupCode) {
+  auto bundle = bundleFromString(makeBundle("startup();", {"a();"}));
+  auto startupCode = bundle->getStartupCode();
+  EXPECT_EQ(toString(*startupCode), "startup();");
+  EXPECT_EQ(startupCode->c_str()[startupCode->size()], '\0');
+}
+
+TEST(JSIndexedRAMBundle, Modules) {
+  auto bundle = bundleFromString(
+      makeBundle("startup();", {"zero();", "", "two(); two();"}));
+
+  auto module = bundle->getModule(0);
+  EXPECT_EQ(module.name, "0.js");
+  EXPECT_EQ(module.code, "zero();");
+
+  auto bigStringModule = bundle->getBigStringModule(2);
+  EXPECT_EQ(bigStringModule.name, "2.js");
+  EXPECT_EQ(toString(*bigStringModule.code), "two(); two();");
+  EXPECT_EQ(bigStringModule.code->c_str()[bigStringModule.code->size()], '\0');
+
+  // Views stay valid after the bundle is gone.
+  bundle.reset();
+  EXPECT_EQ(toString(*bigStringModule.code), "two(); two();");
+}
+
+TEST(JSIndexedRAMBundle, MissingModules) {
+  auto bundle = bundleFromString(makeBundle("startup();", {"zero();", ""}));
+  EXPECT_THROW(bundle->getModule(1), std::ios_base::failure);
+  EXPECT_THROW(bundle->getBigStringModule(2), std::ios_base::failure);
+}
+
+TEST(JSIndexedRAMBundle, TruncatedBundle) {
+  auto bundle = makeBundle("startup();", {"zero();", "one();"});
+
+  EXPECT_THROW(bundleFromString(bundle.substr(0, 8)), std::ios_base::failure);
+  // table cut in half
+  EXPECT_THROW(bundleFromString(bundle.substr(0, 20)), std::ios_base::failure);
+  // startup code cut
+  EXPECT_THROW(bundleFromString(bundle.substr(0, 33)), std::ios_base::failure);
+
+  auto truncated = bundleFromString(bundle.substr(0, bundle.size() - 2));
+  EXPECT_EQ(truncated->getModule(0).code, "zero();");
+  EXPECT_THROW(truncated->getModule(1), std::ios_base::failure);
+}
+
+TEST(JSIndexedRAMBundle, MappedBundle) {
+  const char *tmpDir = getenv("TMPDIR");
+  std::string path = std::string{tmpDir ? tmpDir : "/tmp"} + "/bundle.XXXXXX";
+  int fd = mkstemp(&path[0]);
+  ASSERT_NE(fd, -1);
+  auto contents = makeBundle("startup();", {"zero();", "one();"});
+  ASSERT_EQ(
+      write(fd, contents.data(), contents.size()),
+      static_cast<ssize_t>(contents.size()));
+  close(fd);
+
+  auto bundle = std::make_unique<JSIndexedRAMBundle>(path.c_str());
+  unlink(path.c_str());
+
+  bundle->prefetchModules({1, 0, 42});
+  EXPECT_EQ(toString(*bundle->getStartupCode()), "startup();");
+  auto module = bundle->getBigStringModule(1);
+  bundle.reset();
+  EXPECT_EQ(module.name, "1.js");
+  EXPECT_EQ(toString(*module.code), "one();");
+}
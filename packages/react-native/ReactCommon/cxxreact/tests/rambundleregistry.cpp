@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxreact/RAMBundleRegistry.h>
+#include <cxxreact/ReactMarker.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+
+namespace {
+class FakeUnbundle : public JSModulesUnbundle {
+ public:
+  Module getModule(uint32_t moduleId) const override {
+    if (moduleId >= 10) {
+      throw ModuleNotFound(moduleId);
+    }
+    return {
+        folly::to<std::string>(moduleId, ".js"),
+        folly::to<std::string>("module", moduleId, "();")};
+  }
+};
+
+std::string tempPath() {
+  const char *tmpDir = getenv("TMPDIR");
+  std::string path = std::string{tmpDir ? tmpDir : "/tmp"} + "/trace.XXXXXX";
+  int fd = mkstemp(&path[0]);
+  close(fd);
+  return path;
+}
+
+std::string readFile(const std::string &path) {
+  std::ifstream file(path);
+  return std::string(
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+std::mutex markersMutex;
+std::vector<std::pair<ReactMarker::ReactMarkerId, std::string>> markers;
+
+void logTaggedMarker(
+    const ReactMarker::ReactMarkerId markerId,
+    const char *tag) {
+  std::lock_guard<std::mutex> lock(markersMutex);
+  markers.emplace_back(markerId, tag ? tag : "");
+}
+} // namespace
+
+TEST(RAMBundleRegistry, RecordsStartupTrace) {
+  auto tracePath = tempPath();
+  {
+    auto registry = RAMBundleRegistry::singleBundleRegistry(
+        std::make_unique<FakeUnbundle>());
+    registry->recordStartupTrace(tracePath, std::chrono::hours(1));
+    registry->getModule(0, 3);
+    registry->getBigStringModule(0, 1);
+    registry->getModule(0, 3);
+    EXPECT_THROW(registry->getModule(0, 42), JSModulesUnbundle::ModuleNotFound);
+    EXPECT_EQ(readFile(tracePath), "");
+  }
+  EXPECT_EQ(readFile(tracePath), "0 3\n0 1\n");
+  unlink(tracePath.c_str());
+}
+
+TEST(RAMBundleRegistry, StopsRecordingStartupTraceAfterDuration) {
+  auto tracePath = tempPath();
+  {
+    auto registry = RAMBundleRegistry::singleBundleRegistry(
+        std::make_unique<FakeUnbundle>());
+    registry->recordStartupTrace(tracePath, std::chrono::milliseconds(20));
+    registry->getModule(0, 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    registry->getModule(0, 5);
+    registry->getModule(0, 6);
+  }
+  // Written in the background once the duration was over.
+  EXPECT_EQ(readFile(tracePath), "0 2\n");
+  unlink(tracePath.c_str());
+}
+
+TEST(RAMBundleRegistry, PrefetchesStartupTrace) {
+  auto tracePath = tempPath();
+  std::ofstream(tracePath) << "0 4\n0 42\n7 1\n0 2\n";
+
+  ReactMarker::logTaggedMarkerImpl = logTaggedMarker;
+  markers.clear();
+
+  std::vector<std::string> loadedModules;
+  {
+    auto registry = RAMBundleRegistry::singleBundleRegistry(
+        std::make_unique<FakeUnbundle>());
+    registry->prefetchStartupTrace(
+        tracePath,
+        [&](uint32_t bundleId,
+            uint32_t moduleId,
+            const JSModulesUnbundle::BigStringModule &module) {
+          loadedModules.push_back(
+              module.name + ":" +
+              std::string(module.code->c_str(), module.code->size()));
+        });
+
+    // Waiting for the background thread to get through the trace.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (true) {
+      registry->getModule(0, 2);
+      std::lock_guard<std::mutex> lock(markersMutex);
+      if (markers.back().first == ReactMarker::NATIVE_REQUIRE_PREFETCH_HIT ||
+          std::chrono::steady_clock::now() > deadline) {
+        break;
+      }
+    }
+    markers.clear();
+
+    registry->getModule(0, 4);
+    registry->getModule(0, 5);
+  }
+
+  EXPECT_EQ(
+      loadedModules,
+      (std::vector<std::string>{"4.js:module4();", "2.js:module2();"}));
+  ASSERT_EQ(markers.size(), 2);
+  EXPECT_EQ(markers[0].first, ReactMarker::NATIVE_REQUIRE_PREFETCH_HIT);
+  EXPECT_EQ(markers[0].second, "4.js");
+  EXPECT_EQ(markers[1].first, ReactMarker::NATIVE_REQUIRE_PREFETCH_MISS);
+  EXPECT_EQ(markers[1].second, "5.js");
+
+  ReactMarker::logTaggedMarkerImpl = nullptr;
+  unlink(tracePath.c_str());
+}
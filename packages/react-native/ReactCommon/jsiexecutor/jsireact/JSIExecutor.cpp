@@ -413,8 +413,7 @@ void JSIExecutor::callNativeModules(const Value &queue, bool isEndOfBatch) {
 #endif
   BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
 
-  delegate_->callNativeModules(
-      *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
+  delegate_->callNativeModules(*this, *runtime_, queue, isEndOfBatch);
 }
 
 void JSIExecutor::flush() {
@@ -457,10 +456,10 @@ Value JSIExecutor::nativeRequire(const Value *args, size_t count) {
 
   uint32_t moduleId = folly::to<uint32_t>(args[0].getNumber());
   uint32_t bundleId = count == 2 ? folly::to<uint32_t>(args[1].getNumber()) : 0;
-  auto module = bundleRegistry_->getModule(bundleId, moduleId);
+  auto module = bundleRegistry_->getBigStringModule(bundleId, moduleId);
 
   runtime_->evaluateJavaScript(
-      std::make_unique<StringBuffer>(module.code), module.name);
+      std::make_unique<BigStringBuffer>(std::move(module.code)), module.name);
   return facebook::jsi::Value();
 }
 
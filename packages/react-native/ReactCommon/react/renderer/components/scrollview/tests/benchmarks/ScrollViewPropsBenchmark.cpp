@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/utils/ContextContainer.h>
+#include <string>
+
+namespace facebook::react {
+
+auto contextContainer = std::make_shared<ContextContainer const>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto scrollViewComponentDescriptor = ScrollViewComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+
+// Besides view props, scroll views have dozens of their own, some of which
+// are requested by more than one nested struct (and thus out of order).
+auto scrollViewPropsString = std::string{
+    R"({"flex": 1, "backgroundColor": 4294967295, "horizontal": true, "pagingEnabled": true, "showsHorizontalScrollIndicator": false, "decelerationRate": 0.998, "scrollEventThrottle": 16, "contentInset": {"top": 0, "left": 16, "bottom": 0, "right": 16}, "contentOffset": {"x": 0, "y": 0}, "snapToInterval": 320, "snapToAlignment": "center", "keyboardDismissMode": "on-drag", "testID": "carousel"})"};
+auto scrollViewPropsDynamic = folly::parseJson(scrollViewPropsString);
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+auto scrollViewPropsValue =
+    jsi::valueFromDynamic(*runtime, scrollViewPropsDynamic);
+
+static void propParsingScrollViewRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    scrollViewComponentDescriptor.cloneProps(
+        parserContext, nullptr, RawProps{scrollViewPropsDynamic});
+  }
+}
+BENCHMARK(propParsingScrollViewRawProps);
+
+static void propParsingScrollViewJSIRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    scrollViewComponentDescriptor.cloneProps(
+        parserContext, nullptr, RawProps{*runtime, scrollViewPropsValue});
+  }
+}
+BENCHMARK(propParsingScrollViewJSIRawProps);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
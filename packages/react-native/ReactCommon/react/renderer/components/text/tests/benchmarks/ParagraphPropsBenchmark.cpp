@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <react/renderer/components/text/ParagraphComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/utils/ContextContainer.h>
+#include <string>
+
+namespace facebook::react {
+
+auto contextContainer = std::make_shared<ContextContainer const>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto paragraphComponentDescriptor = ParagraphComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+
+// Besides view props, paragraphs have dozens of their own, some of which
+// are requested by more than one nested struct (and thus out of order).
+auto paragraphPropsString = std::string{
+    R"({"numberOfLines": 2, "ellipsizeMode": "tail", "selectable": true, "color": 4278190080, "fontFamily": "System", "fontSize": 15, "fontWeight": "600", "lineHeight": 20, "letterSpacing": 0.2, "textAlign": "left", "textDecorationLine": "underline", "margin": 4, "accessibilityRole": "text", "testID": "title"})"};
+auto paragraphPropsDynamic = folly::parseJson(paragraphPropsString);
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+auto paragraphPropsValue =
+    jsi::valueFromDynamic(*runtime, paragraphPropsDynamic);
+
+static void propParsingParagraphRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    paragraphComponentDescriptor.cloneProps(
+        parserContext, nullptr, RawProps{paragraphPropsDynamic});
+  }
+}
+BENCHMARK(propParsingParagraphRawProps);
+
+static void propParsingParagraphJSIRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    paragraphComponentDescriptor.cloneProps(
+        parserContext, nullptr, RawProps{*runtime, paragraphPropsValue});
+  }
+}
+BENCHMARK(propParsingParagraphJSIRawProps);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
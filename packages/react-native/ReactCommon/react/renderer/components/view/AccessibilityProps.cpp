@@ -19,6 +19,17 @@ AccessibilityProps::AccessibilityProps(
     const PropsParserContext &context,
     AccessibilityProps const &sourceProps,
     RawProps const &rawProps)
+    : AccessibilityProps(
+          context,
+          sourceProps,
+          rawProps,
+          RawProps::Group{rawProps, "AccessibilityProps"}) {}
+
+AccessibilityProps::AccessibilityProps(
+    const PropsParserContext &context,
+    AccessibilityProps const &sourceProps,
+    RawProps const &rawProps,
+    RawProps::Group const & /*group*/)
     : accessible(
           CoreFeatures::enablePropIteratorSetter ? sourceProps.accessible
                                                  : convertRawProp(
@@ -65,6 +65,17 @@ class AccessibilityProps {
 #if RN_DEBUG_STRING_CONVERTIBLE
   SharedDebugStringConvertibleList getDebugProps() const;
 #endif
+
+ private:
+  /*
+   * Requests all the props within the given group (which is alive until the
+   * constructor returns).
+   */
+  AccessibilityProps(
+      const PropsParserContext &context,
+      AccessibilityProps const &sourceProps,
+      RawProps const &rawProps,
+      RawProps::Group const &group);
 };
 
 } // namespace react
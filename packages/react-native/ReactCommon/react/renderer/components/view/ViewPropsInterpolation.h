@@ -45,10 +45,10 @@ static inline void interpolateViewProps(
   // be const again.
 #ifdef ANDROID
   if (!interpolatedProps->rawProps.isNull()) {
-    interpolatedProps->rawProps["opacity"] = interpolatedProps->opacity;
-
-    interpolatedProps->rawProps["transform"] =
-        (folly::dynamic)interpolatedProps->transform;
+    interpolatedProps->rawProps =
+        interpolatedProps->rawProps.merged(DynamicPropsChain{
+            folly::dynamic::object("opacity", interpolatedProps->opacity)(
+                "transform", (folly::dynamic)interpolatedProps->transform)});
   }
 #endif
 }
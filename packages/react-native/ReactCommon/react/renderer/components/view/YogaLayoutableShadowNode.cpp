@@ -12,15 +12,18 @@
 #include <react/renderer/components/view/ViewProps.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
 #include <react/renderer/components/view/conversions.h>
+#include <react/renderer/core/CoreFeatures.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/TraitCast.h>
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <yoga/Yoga.h>
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <thread>
 
 namespace facebook::react {
 
@@ -59,8 +62,6 @@ static int FabricDefaultYogaLog(
   return size_s;
 }
 
-thread_local LayoutContext threadLocalLayoutContext;
-
 ShadowNodeTraits YogaLayoutableShadowNode::BaseTraits() {
   auto traits = LayoutableShadowNode::BaseTraits();
   traits.set(IdentifierTrait());
@@ -545,15 +546,20 @@ void YogaLayoutableShadowNode::layoutTree(
   auto direction =
       yogaDirectionFromLayoutDirection(layoutConstraints.layoutDirection);
 
-  threadLocalLayoutContext = layoutContext;
-
   if (layoutContext.swapLeftAndRightInRTL) {
     swapLeftAndRightInTree(*this);
   }
 
   {
     SystraceSection s("YogaLayoutableShadowNode::YGNodeCalculateLayout");
-    YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
+    // The layout context is passed to measure functions (which can be called
+    // on multiple threads, see `CoreFeatures::enableParallelLayout`).
+    YGNodeCalculateLayoutWithContext(
+        &yogaNode_,
+        ownerWidth,
+        ownerHeight,
+        direction,
+        const_cast<LayoutContext *>(&layoutContext));
   }
 
   if (yogaNode_.getHasNewLayout()) {
@@ -563,6 +569,11 @@ void YogaLayoutableShadowNode::layoutTree(
     yogaNode_.setHasNewLayout(false);
   }
 
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  if (telemetry != nullptr) {
+    telemetry->didVisitLayoutNodes(1);
+  }
+
   layout(layoutContext);
 }
 
@@ -584,6 +595,15 @@ void YogaLayoutableShadowNode::layout(LayoutContext layoutContext) {
   // Reading data from a dirtied node does not make sense.
   react_native_assert(!yogaNode_.isDirty());
 
+  // Only children of nodes with a new layout are visited, so the number of
+  // visited nodes is proportional to the size of dirty paths (including
+  // siblings of nodes on them) rather than to the size of the tree.
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  if (telemetry != nullptr) {
+    telemetry->didVisitLayoutNodes(
+        static_cast<int>(yogaNode_.getChildren().size()));
+  }
+
   auto contentFrame = Rect{};
   for (auto childYogaNode : yogaNode_.getChildren()) {
     auto &childNode = shadowNodeFromContext(childYogaNode);
@@ -616,9 +636,23 @@ void YogaLayoutableShadowNode::layout(LayoutContext layoutContext) {
         layoutContext.affectedNodes->push_back(&childNode);
       }
 
+      // If Yoga served the layout of a non-leaf child from its cache, nothing
+      // in the subtree of the child was laid out, so the child does not need
+      // to visit its children and its overflow inset is still valid.
+      auto shouldLayoutChild =
+          newLayoutMetrics.displayType != DisplayType::None;
+      if (shouldLayoutChild && CoreFeatures::enableIncrementalLayout &&
+          childYogaNode->getLayout().hadCachedLayout() &&
+          !childNode.getTraits().check(
+              ShadowNodeTraits::Trait::LeafYogaNode)) {
+        newLayoutMetrics.overflowInset =
+            childNode.getLayoutMetrics().overflowInset;
+        shouldLayoutChild = false;
+      }
+
       childNode.setLayoutMetrics(newLayoutMetrics);
 
-      if (newLayoutMetrics.displayType != DisplayType::None) {
+      if (shouldLayoutChild) {
         childNode.layout(layoutContext);
       }
     }
@@ -695,7 +729,8 @@ YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
     float width,
     YGMeasureMode widthMode,
     float height,
-    YGMeasureMode heightMode) {
+    YGMeasureMode heightMode,
+    void *layoutContext) {
   SystraceSection s(
       "YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector");
 
@@ -731,7 +766,8 @@ YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
   }
 
   auto size = shadowNode.measureContent(
-      threadLocalLayoutContext, {minimumSize, maximumSize});
+      *static_cast<LayoutContext const *>(layoutContext),
+      {minimumSize, maximumSize});
 
   return YGSize{
       yogaFloatFromFloat(size.width), yogaFloatFromFloat(size.height)};
@@ -747,6 +783,11 @@ YGConfig &YogaLayoutableShadowNode::initializeYogaConfig(YGConfig &config) {
   config.setCloneNodeCallback(
       YogaLayoutableShadowNode::yogaNodeCloneCallbackConnector);
   config.useLegacyStretchBehaviour = true;
+  config.skipUnchangedSubtreesWhenRounding =
+      CoreFeatures::enableIncrementalLayout;
+  config.parallelLayoutThreadCount = CoreFeatures::enableParallelLayout
+      ? std::thread::hardware_concurrency()
+      : 0;
 #ifdef RN_DEBUG_YOGA_LOGGER
   config.printTree = true;
 #endif
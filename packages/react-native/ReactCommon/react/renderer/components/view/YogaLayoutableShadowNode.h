@@ -143,7 +143,8 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
       float width,
       YGMeasureMode widthMode,
       float height,
-      YGMeasureMode heightMode);
+      YGMeasureMode heightMode,
+      void *layoutContext);
   static YogaLayoutableShadowNode &shadowNodeFromContext(YGNode *yogaNode);
 
 #pragma mark - RTL Legacy Autoflip
@@ -24,11 +24,13 @@ YogaStylableProps::YogaStylableProps(
     YogaStylableProps const &sourceProps,
     RawProps const &rawProps,
     bool shouldSetRawProps)
-    : Props(context, sourceProps, rawProps, shouldSetRawProps),
-      yogaStyle(
-          CoreFeatures::enablePropIteratorSetter
-              ? sourceProps.yogaStyle
-              : convertRawProp(context, rawProps, sourceProps.yogaStyle)) {
+    : Props(context, sourceProps, rawProps, shouldSetRawProps) {
+  // Most updates don't touch layout; the group lets them skip over a hundred
+  // lookups of Yoga props at once.
+  auto group = RawProps::Group{rawProps, "YogaStylableProps"};
+  yogaStyle = CoreFeatures::enablePropIteratorSetter
+      ? sourceProps.yogaStyle
+      : convertRawProp(context, rawProps, sourceProps.yogaStyle);
   if (!CoreFeatures::enablePropIteratorSetter) {
     convertRawPropAliases(context, sourceProps, rawProps);
   }
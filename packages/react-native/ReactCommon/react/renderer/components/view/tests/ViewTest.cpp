@@ -6,7 +6,10 @@
  */
 
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <memory>
+#include <random>
 
 #include <gtest/gtest.h>
 
@@ -14,8 +17,11 @@
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/CoreFeatures.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+#include <yoga/Yoga.h>
 
 #include <react/renderer/element/Element.h>
 #include <react/renderer/element/testUtils.h>
@@ -226,4 +232,186 @@ TEST_F(YogaDirtyFlagTest, updatingStateForScrollViewMistNotDirtyYogaNode) {
       static_cast<RootShadowNode &>(*newRootShadowNode).layoutIfNeeded());
 }
 
+class YogaLayoutTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    CoreFeatures::enableIncrementalLayout = enableIncrementalLayout_;
+  }
+
+ private:
+  bool enableIncrementalLayout_{CoreFeatures::enableIncrementalLayout};
+};
+
+TEST_F(YogaLayoutTest, layoutPassVisitsOnlyDirtyPaths) {
+  CoreFeatures::enableIncrementalLayout = true;
+
+  auto builder = simpleComponentBuilder();
+
+  auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+  auto leafShadowNode = std::shared_ptr<ViewShadowNode>{};
+
+  // A root with 10 containers, each of them with 10 leaf views.
+  auto containers = std::vector<ElementFragment>{};
+  auto tag = Tag{2};
+  for (int i = 0; i < 10; i++) {
+    auto leaves = std::vector<ElementFragment>{};
+    for (int j = 0; j < 10; j++) {
+      auto leaf = Element<ViewShadowNode>().tag(tag++);
+      if (i == 5 && j == 5) {
+        leaf.reference(leafShadowNode);
+      }
+      leaves.push_back(leaf);
+    }
+    containers.push_back(
+        Element<ViewShadowNode>().tag(tag++).children(leaves));
+  }
+
+  builder.build(Element<RootShadowNode>()
+                    .reference(rootShadowNode)
+                    .tag(1)
+                    .children(containers));
+
+  {
+    auto telemetry = TransactionTelemetry{};
+    telemetry.setAsThreadLocal();
+    EXPECT_TRUE(rootShadowNode->layoutIfNeeded());
+    telemetry.unsetAsThreadLocal();
+
+    // The initial layout pass visits every node.
+    EXPECT_EQ(telemetry.getNumberOfLayoutVisitedNodes(), 111);
+  }
+
+  auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+      rootShadowNode->cloneTree(
+          leafShadowNode->getFamily(), [](ShadowNode const &oldShadowNode) {
+            auto viewProps = std::make_shared<ViewShadowNodeProps>();
+            viewProps->yogaStyle.dimensions()[YGDimensionHeight] =
+                YGValue{42, YGUnitPoint};
+            return oldShadowNode.clone(ShadowNodeFragment{viewProps});
+          }));
+
+  {
+    auto telemetry = TransactionTelemetry{};
+    telemetry.setAsThreadLocal();
+    EXPECT_TRUE(newRootShadowNode->layoutIfNeeded());
+    telemetry.unsetAsThreadLocal();
+
+    // Only the root, the containers, and the children of the container with
+    // the changed leaf are visited.
+    EXPECT_EQ(telemetry.getNumberOfLayoutVisitedNodes(), 21);
+  }
+}
+
+/*
+ * Builds a random Yoga tree (the same one for the same `seed`) with
+ * fractional sizes and offsets, so that rounding to the pixel grid matters.
+ */
+static std::vector<YGNodeRef> buildRandomYogaTree(
+    YGConfigRef config,
+    unsigned seed) {
+  auto random = std::mt19937{seed};
+  auto fraction = std::uniform_real_distribution<float>{0, 1};
+
+  auto root = YGNodeNewWithConfig(config);
+  YGNodeStyleSetWidth(root, 400);
+  YGNodeStyleSetHeight(root, 800);
+  auto nodes = std::vector<YGNodeRef>{root};
+
+  auto size = std::uniform_int_distribution<size_t>{20, 60}(random);
+  while (nodes.size() < size) {
+    auto owner = nodes[std::uniform_int_distribution<size_t>{
+        0, nodes.size() - 1}(random)];
+    auto node = YGNodeNewWithConfig(config);
+    YGNodeInsertChild(owner, node, YGNodeGetChildCount(owner));
+    nodes.push_back(node);
+
+    if (fraction(random) < 0.5) {
+      YGNodeStyleSetFlexDirection(node, YGFlexDirectionRow);
+    }
+    if (fraction(random) < 0.5) {
+      YGNodeStyleSetFlexGrow(node, 1);
+    }
+    if (fraction(random) < 0.5) {
+      YGNodeStyleSetWidth(node, fraction(random) * 100);
+    }
+    if (fraction(random) < 0.5) {
+      YGNodeStyleSetHeight(node, fraction(random) * 100);
+    }
+    YGNodeStyleSetMargin(node, YGEdgeLeft, fraction(random) * 10);
+    YGNodeStyleSetMargin(node, YGEdgeTop, fraction(random) * 10);
+    YGNodeStyleSetPadding(node, YGEdgeAll, fraction(random) * 5);
+  }
+
+  return nodes;
+}
+
+/*
+ * Lays out random trees (and then changes and lays them out again a few
+ * times) with a default config and with a config set up by `configure`, and
+ * checks that the results are exactly the same.
+ */
+static void expectSameLayoutOfRandomTrees(
+    std::function<void(YGConfigRef config)> const &configure) {
+  for (unsigned seed = 0; seed < 100; seed++) {
+    auto configs = std::array<YGConfigRef, 2>{YGConfigNew(), YGConfigNew()};
+    for (auto config : configs) {
+      YGConfigSetPointScaleFactor(config, 3);
+    }
+    configure(configs[1]);
+
+    auto trees = std::array<std::vector<YGNodeRef>, 2>{
+        buildRandomYogaTree(configs[0], seed),
+        buildRandomYogaTree(configs[1], seed)};
+
+    auto random = std::mt19937{seed};
+    for (int pass = 0; pass < 10; pass++) {
+      for (auto const &tree : trees) {
+        YGNodeCalculateLayout(
+            tree[0], YGUndefined, YGUndefined, YGDirectionLTR);
+      }
+
+      for (size_t i = 0; i < trees[0].size(); i++) {
+        auto expected = trees[0][i];
+        auto actual = trees[1][i];
+        EXPECT_EQ(YGNodeLayoutGetLeft(expected), YGNodeLayoutGetLeft(actual));
+        EXPECT_EQ(YGNodeLayoutGetTop(expected), YGNodeLayoutGetTop(actual));
+        EXPECT_EQ(
+            YGNodeLayoutGetWidth(expected), YGNodeLayoutGetWidth(actual));
+        EXPECT_EQ(
+            YGNodeLayoutGetHeight(expected), YGNodeLayoutGetHeight(actual));
+      }
+
+      // Alternates moving a random node (which moves its subtree) and
+      // resizing one (which keeps many subtrees of its siblings in place).
+      auto index = std::uniform_int_distribution<size_t>{
+          1, trees[0].size() - 1}(random);
+      auto value = std::uniform_real_distribution<float>{0, 10}(random);
+      for (auto const &tree : trees) {
+        if (pass % 2 == 0) {
+          YGNodeStyleSetMargin(tree[index], YGEdgeLeft, value);
+        } else {
+          YGNodeStyleSetHeight(tree[index], value);
+        }
+      }
+    }
+
+    for (size_t i = 0; i < trees.size(); i++) {
+      YGNodeFreeRecursive(trees[i][0]);
+      YGConfigFree(configs[i]);
+    }
+  }
+}
+
+TEST(YogaRoundingTest, skippingUnchangedSubtreesDoesNotChangeLayout) {
+  expectSameLayoutOfRandomTrees([](YGConfigRef config) {
+    YGConfigSetSkipUnchangedSubtreesWhenRounding(config, true);
+  });
+}
+
+TEST(YogaParallelLayoutTest, parallelLayoutMatchesSerialLayout) {
+  expectSameLayoutOfRandomTrees([](YGConfigRef config) {
+    YGConfigSetParallelLayoutThreadCount(config, 4);
+  });
+}
+
 } // namespace facebook::react
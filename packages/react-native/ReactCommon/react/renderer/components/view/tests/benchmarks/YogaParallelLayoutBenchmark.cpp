@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <yoga/Yoga.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Simulates measuring a piece of text: a couple of microseconds of pure
+ * computation whose result depends on the available width.
+ */
+static YGSize measureText(
+    YGNodeRef /*node*/,
+    float width,
+    YGMeasureMode widthMode,
+    float /*height*/,
+    YGMeasureMode /*heightMode*/) {
+  auto glyphs = 0.0f;
+  for (int i = 0; i < 2000; i++) {
+    glyphs += std::sqrt(static_cast<float>(i));
+  }
+  benchmark::DoNotOptimize(glyphs);
+
+  auto const textWidth = 180.0f;
+  auto const lineWidth = widthMode == YGMeasureModeUndefined
+      ? textWidth
+      : std::min(width, textWidth);
+  auto const lines = std::ceil(textWidth / std::max(lineWidth, 1.0f));
+  return YGSize{lineWidth, lines * 17.0f};
+}
+
+/*
+ * A feed of fixed-size cards (the layout-independent subtrees), each of them
+ * containing a header and a few rows of text.
+ */
+struct Feed {
+  YGConfigRef config;
+  YGNodeRef root;
+  std::vector<YGNodeRef> texts;
+
+  Feed(int numberOfCards, uint32_t numberOfThreads) {
+    config = YGConfigNew();
+    YGConfigSetPointScaleFactor(config, 3);
+    YGConfigSetParallelLayoutThreadCount(config, numberOfThreads);
+
+    root = YGNodeNewWithConfig(config);
+    YGNodeStyleSetWidth(root, 1080);
+    YGNodeStyleSetFlexDirection(root, YGFlexDirectionRow);
+    YGNodeStyleSetFlexWrap(root, YGWrapWrap);
+
+    for (int i = 0; i < numberOfCards; i++) {
+      auto card = YGNodeNewWithConfig(config);
+      YGNodeStyleSetWidth(card, 360);
+      YGNodeStyleSetHeight(card, 480);
+      YGNodeStyleSetPadding(card, YGEdgeAll, 8);
+      YGNodeInsertChild(root, card, YGNodeGetChildCount(root));
+
+      auto header = YGNodeNewWithConfig(config);
+      YGNodeStyleSetFlexDirection(header, YGFlexDirectionRow);
+      YGNodeStyleSetAlignItems(header, YGAlignCenter);
+      YGNodeInsertChild(card, header, 0);
+
+      auto avatar = YGNodeNewWithConfig(config);
+      YGNodeStyleSetWidth(avatar, 40);
+      YGNodeStyleSetHeight(avatar, 40);
+      YGNodeInsertChild(header, avatar, 0);
+      addText(header, 1);
+
+      for (int j = 0; j < 6; j++) {
+        auto row = YGNodeNewWithConfig(config);
+        YGNodeStyleSetFlexDirection(row, YGFlexDirectionRow);
+        YGNodeStyleSetMargin(row, YGEdgeTop, 4);
+        YGNodeInsertChild(card, row, YGNodeGetChildCount(card));
+        addText(row, 0);
+        addText(row, 1);
+      }
+    }
+  }
+
+  ~Feed() {
+    YGNodeFreeRecursive(root);
+    YGConfigFree(config);
+  }
+
+  void addText(YGNodeRef owner, float flexGrow) {
+    auto text = YGNodeNewWithConfig(config);
+    YGNodeStyleSetFlexGrow(text, flexGrow);
+    YGNodeStyleSetFlexShrink(text, 1);
+    YGNodeSetMeasureFunc(text, measureText);
+    YGNodeInsertChild(owner, text, YGNodeGetChildCount(owner));
+    texts.push_back(text);
+  }
+};
+
+/*
+ * Lays out the whole feed from scratch. The argument is the number of threads
+ * (1 means the regular, serial layout).
+ */
+static void layoutFeed(benchmark::State &state) {
+  auto feed = Feed{200, static_cast<uint32_t>(state.range(0))};
+
+  for (auto _ : state) {
+    for (auto text : feed.texts) {
+      YGNodeMarkDirty(text);
+    }
+    YGNodeCalculateLayout(feed.root, 1080, YGUndefined, YGDirectionLTR);
+  }
+}
+BENCHMARK(layoutFeed)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AncestorIndex.h"
+
+#include <react/renderer/core/ShadowNode.h>
+
+namespace facebook::react {
+
+int AncestorIndex::getChildIndex(
+    ShadowNode const &parentShadowNode,
+    ShadowNodeFamily const &childFamily) const {
+  auto const &children = parentShadowNode.getChildren();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto it = locations_.find(&childFamily);
+  if (it != locations_.end()) {
+    auto const &location = it->second;
+    // The stored parent might be deallocated (and its address reused), so we
+    // also check that the child at the stored position belongs to the family.
+    if (location.parentShadowNode == &parentShadowNode &&
+        location.childIndex < static_cast<int>(children.size()) &&
+        &children[location.childIndex]->getFamily() == &childFamily) {
+      return location.childIndex;
+    }
+  }
+
+  auto result = -1;
+  auto childIndex = 0;
+  for (auto const &childShadowNode : children) {
+    auto family = &childShadowNode->getFamily();
+    locations_[family] = Location{&parentShadowNode, childIndex};
+    if (family == &childFamily && result == -1) {
+      result = childIndex;
+    }
+    childIndex++;
+  }
+
+  return result;
+}
+
+} // namespace facebook::react
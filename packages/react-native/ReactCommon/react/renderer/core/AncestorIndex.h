@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook {
+namespace react {
+
+class ShadowNode;
+class ShadowNodeFamily;
+
+/*
+ * Memoizes positions of shadow nodes in children lists of their parents.
+ * With the index, `ShadowNodeFamily::getAncestors` costs O(depth) instead of
+ * O(depth * number of siblings) for all lookups in the same (committed) tree
+ * except the first ones: every children list is scanned at most once, and
+ * positions of all children are recorded during the scan.
+ *
+ * Memoized positions are validated before use, so using the index with
+ * different trees is safe (but not efficient).
+ * Thread-safe.
+ */
+class AncestorIndex final {
+ public:
+  /*
+   * Returns an index of the child of `parentShadowNode` which belongs to
+   * `childFamily`, or `-1` if there is no such child.
+   */
+  int getChildIndex(
+      ShadowNode const &parentShadowNode,
+      ShadowNodeFamily const &childFamily) const;
+
+ private:
+  struct Location {
+    ShadowNode const *parentShadowNode;
+    int childIndex;
+  };
+
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<ShadowNodeFamily const *, Location> locations_;
+};
+
+} // namespace react
+} // namespace facebook
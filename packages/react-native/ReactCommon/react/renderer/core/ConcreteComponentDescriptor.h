@@ -136,8 +136,10 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     // On Android only, the merged props should have the same RawProps as the
     // final props struct
     Props::Shared interpolatedPropsShared =
-        (newProps != nullptr ? cloneProps(context, newProps, newProps->rawProps)
-                             : cloneProps(context, newProps, {}));
+        (newProps != nullptr
+             ? cloneProps(
+                   context, newProps, newProps->rawProps.materialize())
+             : cloneProps(context, newProps, {}));
 #else
     Props::Shared interpolatedPropsShared = cloneProps(context, newProps, {});
 #endif
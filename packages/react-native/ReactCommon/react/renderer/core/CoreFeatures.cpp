@@ -15,6 +15,12 @@ bool CoreFeatures::enableMapBuffer = false;
 bool CoreFeatures::blockPaintForUseLayoutEffect = false;
 bool CoreFeatures::useNativeState = false;
 bool CoreFeatures::cacheNSTextStorage = false;
+bool CoreFeatures::enableParallelDiffing = false;
+bool CoreFeatures::enableSubtreeHashDiffing = false;
+bool CoreFeatures::enableIncrementalLayout = false;
+bool CoreFeatures::enableParallelLayout = false;
+bool CoreFeatures::enableSpeculativeDiffing = false;
+bool CoreFeatures::enableCommitRebasing = false;
 
 } // namespace react
 } // namespace facebook
@@ -39,6 +39,40 @@ class CoreFeatures {
   // creating it twice. Once when measuring text and once when rendering it.
   // This flag caches it inside ParagraphState.
   static bool cacheNSTextStorage;
+
+  // When enabled, the Differentiator diffs independent sibling subtrees on a
+  // small pool of worker threads. The resulting list of mutations is exactly
+  // the same as the one produced by the serial algorithm.
+  static bool enableParallelDiffing;
+
+  // When enabled, the Differentiator does not descend into a pair of different
+  // nodes whose subtrees have equal content (see
+  // `ShadowNode::getSubtreeHash()`), e.g. nodes cloned by layout which ended
+  // up with the same layout metrics.
+  static bool enableSubtreeHashDiffing;
+
+  // When enabled, the layout pass does not descend into subtrees whose layout
+  // was served from the Yoga cache to copy their layout metrics, nor to round
+  // them to the pixel grid if that would not change them, so the cost of a
+  // layout pass scales with the size of the change instead of the size of
+  // the tree.
+  static bool enableIncrementalLayout;
+
+  // When enabled, Yoga lays out subtrees of nodes with exactly defined
+  // dimensions on a pool of threads. Requires measure functions of all
+  // components (e.g. text measurement) to be safe to call on any thread.
+  static bool enableParallelLayout;
+
+  // When enabled, `MountingCoordinator` diffs every newly committed revision
+  // on a background thread right away, so `pullTransaction` (called by the
+  // mounting layer, usually on the main thread) can return the precomputed
+  // mutations instead of diffing the trees itself.
+  static bool enableSpeculativeDiffing;
+
+  // When enabled, a commit which lost a race with another one replays the
+  // props and state changes it made on top of the newer tree instead of
+  // running the whole transaction again (unless the changes conflict).
+  static bool enableCommitRebasing;
 };
 
 } // namespace react
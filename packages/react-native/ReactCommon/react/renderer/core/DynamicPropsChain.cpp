@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DynamicPropsChain.h"
+
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Nodes which are cloned many times before being mounted accumulate patches;
+ * longer chains are squashed into a single patch.
+ */
+static constexpr size_t kMaxChainLength = 16;
+
+/*
+ * Returns `true` if applying `patch` overrides every prop of `values`.
+ */
+static bool isShadowedBy(
+    folly::dynamic const &values,
+    folly::dynamic const &patch) {
+  if (!values.isObject() || !patch.isObject() ||
+      values.size() > patch.size()) {
+    return false;
+  }
+  for (auto const &pair : values.items()) {
+    if (patch.count(pair.first) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+DynamicPropsChain::DynamicPropsChain(folly::dynamic patch)
+    : head_(std::make_shared<Patch const>(Patch{
+          std::make_shared<folly::dynamic const>(std::move(patch)),
+          nullptr,
+          1})) {}
+
+DynamicPropsChain DynamicPropsChain::merged(
+    DynamicPropsChain const &patch) const {
+  if (!patch.head_) {
+    return *this;
+  }
+  if (!head_) {
+    return patch;
+  }
+
+  auto patches = std::vector<Patch const *>{};
+  for (auto node = patch.head_.get(); node; node = node->base.get()) {
+    patches.push_back(node);
+  }
+
+  auto result = DynamicPropsChain{};
+  result.head_ = head_;
+  for (auto it = patches.rbegin(); it != patches.rend(); it++) {
+    auto base = result.head_;
+    // Patches which only set props the new one sets too (e.g. an animation
+    // updating the same prop over and over) don't contribute anything.
+    while (base && isShadowedBy(*base->values, *(*it)->values)) {
+      base = base->base;
+    }
+    result.head_ = std::make_shared<Patch const>(
+        Patch{(*it)->values, base, base ? base->length + 1 : 1});
+  }
+
+  if (result.head_->length > kMaxChainLength) {
+    return DynamicPropsChain{result.materialize()};
+  }
+  return result;
+}
+
+bool DynamicPropsChain::isNull() const noexcept {
+  return head_ && !head_->base && head_->values->isNull();
+}
+
+bool DynamicPropsChain::empty() const noexcept {
+  for (auto node = head_.get(); node != nullptr; node = node->base.get()) {
+    if (node->values->isObject() && !node->values->empty()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t DynamicPropsChain::getNumberOfPatches() const noexcept {
+  return head_ ? head_->length : 0;
+}
+
+folly::dynamic DynamicPropsChain::materialize() const {
+  if (!head_) {
+    return folly::dynamic::object();
+  }
+  if (!head_->base &&
+      (head_->values->isObject() || head_->values->isNull())) {
+    return *head_->values;
+  }
+
+  auto patches = std::vector<Patch const *>{};
+  for (auto node = head_.get(); node != nullptr; node = node->base.get()) {
+    patches.push_back(node);
+  }
+
+  // Note, here we have to preserve sub-prop objects with `null` value as
+  // an indication for the legacy mounting layer that it needs to clean them up.
+  folly::dynamic result = folly::dynamic::object();
+  for (auto it = patches.rbegin(); it != patches.rend(); it++) {
+    if (!(*it)->values->isObject()) {
+      continue;
+    }
+    for (auto const &pair : (*it)->values->items()) {
+      result[pair.first] = pair.second;
+    }
+  }
+  return result;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <folly/dynamic.h>
+
+namespace facebook::react {
+
+/*
+ * An immutable dictionary of props (as they came from JavaScript) made of a
+ * chain of patches, each of them applied on top of the previous ones.
+ * Copying and merging share the patches instead of copying the dictionary,
+ * so props of cloned shadow nodes don't carry their own copies of the same
+ * data; the merged dictionary is only built by `materialize` (e.g. when the
+ * props are sent to the mounting layer).
+ * The object is cheap to copy and safe to share between threads.
+ */
+class DynamicPropsChain final {
+ public:
+  /*
+   * Creates an empty dictionary.
+   */
+  DynamicPropsChain() = default;
+
+  /*
+   * Creates a dictionary with a single patch. A `null` patch makes the chain
+   * `null` (see `isNull`).
+   */
+  explicit DynamicPropsChain(folly::dynamic patch);
+
+  /*
+   * Returns a chain with all the patches of `patch` applied on top of this
+   * one (the same as `mergeDynamicProps` does with dictionaries).
+   */
+  DynamicPropsChain merged(DynamicPropsChain const &patch) const;
+
+  /*
+   * Returns `true` if the chain consists of a single `null` patch.
+   */
+  bool isNull() const noexcept;
+
+  /*
+   * Returns `true` if the materialized dictionary is empty (or `null`).
+   */
+  bool empty() const noexcept;
+
+  /*
+   * Returns the number of patches the chain consists of.
+   */
+  size_t getNumberOfPatches() const noexcept;
+
+  /*
+   * Builds the dictionary, applying all the patches in order.
+   */
+  folly::dynamic materialize() const;
+
+ private:
+  struct Patch {
+    std::shared_ptr<folly::dynamic const> values;
+    std::shared_ptr<Patch const> base;
+    size_t length;
+  };
+
+  std::shared_ptr<Patch const> head_{};
+};
+
+} // namespace facebook::react
@@ -86,7 +86,7 @@ void EventEmitter::dispatchEvent(
       RawEvent(
           normalizeEventType(std::move(type)),
           payloadFactory,
-          eventTarget_,
+          getEventTarget(),
           category),
       priority);
 }
@@ -104,31 +104,36 @@ void EventEmitter::dispatchUniqueEvent(
   eventDispatcher->dispatchUniqueEvent(RawEvent(
       normalizeEventType(std::move(type)),
       payloadFactory,
-      eventTarget_,
+      getEventTarget(),
       RawEvent::Category::Continuous));
 }
 
 void EventEmitter::setEnabled(bool enabled) const {
-  enableCounter_ += enabled ? 1 : -1;
-
-  bool shouldBeEnabled = enableCounter_ > 0;
-  if (isEnabled_ != shouldBeEnabled) {
-    isEnabled_ = shouldBeEnabled;
-    if (eventTarget_) {
-      eventTarget_->setEnabled(isEnabled_);
-    }
+  auto delta = enabled ? 1 : -1;
+  auto enableCounter =
+      enableCounter_.fetch_add(delta, std::memory_order_acq_rel) + delta;
+
+  auto eventTarget = getEventTarget();
+  auto isToggled = enabled ? enableCounter == 1 : enableCounter == 0;
+  if (eventTarget && isToggled) {
+    eventTarget->setEnabled(enabled);
   }
 
   // Note: Initially, the state of `eventTarget_` and the value `enableCounter_`
   // is mismatched intentionally (it's `non-null` and `0` accordingly). We need
   // this to support an initial nebula state where the event target must be
   // retained without any associated mounted node.
-  bool shouldBeRetained = enableCounter_ > 0;
-  if (shouldBeRetained != (eventTarget_ != nullptr)) {
-    if (!shouldBeRetained) {
-      eventTarget_.reset();
-    }
+  if (enableCounter <= 0 && eventTarget) {
+    std::atomic_store(&eventTarget_, SharedEventTarget{});
   }
 }
 
+bool EventEmitter::isEnabled() const {
+  return enableCounter_.load(std::memory_order_acquire) > 0;
+}
+
+SharedEventTarget EventEmitter::getEventTarget() const {
+  return std::atomic_load(&eventTarget_);
+}
+
 } // namespace facebook::react
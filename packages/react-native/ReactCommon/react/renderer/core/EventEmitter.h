@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 
@@ -33,6 +34,10 @@ class EventEmitter {
  public:
   using Shared = std::shared_ptr<EventEmitter const>;
 
+  /*
+   * Deprecated. Mounted state of event emitters and event targets is
+   * published atomically and no longer requires this mutex.
+   */
   static std::mutex &DispatchMutex();
 
   static ValueFactory defaultPayloadFactory();
@@ -52,10 +57,18 @@ class EventEmitter {
    * a possibility to extract JSI value from it.
    * The enable state is additive; a number of `enable` calls should be equal to
    * a number of `disable` calls to release the event target.
-   * `DispatchMutex` must be acquired before calling.
+   * Calls for the same emitter must not race with each other (they are
+   * serialized by commits of the surface the emitter belongs to) but can race
+   * with dispatching events on any thread.
    */
   void setEnabled(bool enabled) const;
 
+  /*
+   * Returns `true` if the emitter is enabled (i.e. the node is mounted).
+   * Can be called on any thread.
+   */
+  bool isEnabled() const;
+
  protected:
 #ifdef ANDROID
   // We need this temporarily due to lack of Java-counterparts for particular
@@ -91,13 +104,21 @@ class EventEmitter {
  private:
   void toggleEventTargetOwnership_() const;
 
+  /*
+   * Returns the event target if it is still retained by the emitter.
+   */
+  SharedEventTarget getEventTarget() const;
+
   friend class UIManagerBinding;
 
+  /*
+   * Accessed only via `std::atomic_load` and `std::atomic_store` because it
+   * can be released on a commit while an event is being dispatched.
+   */
   mutable SharedEventTarget eventTarget_;
 
   EventDispatcher::Weak eventDispatcher_;
-  mutable int enableCounter_{0};
-  mutable bool isEnabled_{false};
+  mutable std::atomic<int> enableCounter_{0};
 };
 
 } // namespace react
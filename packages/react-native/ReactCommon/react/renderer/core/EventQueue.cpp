@@ -10,6 +10,9 @@
 #include "EventEmitter.h"
 #include "ShadowNodeFamily.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace facebook::react {
 
 EventQueue::EventQueue(
@@ -22,55 +25,19 @@ EventQueue::EventQueue(
 }
 
 void EventQueue::enqueueEvent(RawEvent &&rawEvent) const {
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    eventQueue_.push_back(std::move(rawEvent));
-  }
+  eventQueue_.push({std::move(rawEvent), /* isUnique = */ false});
 
   onEnqueue();
 }
 
 void EventQueue::enqueueUniqueEvent(RawEvent &&rawEvent) const {
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-
-    auto repeatedEvent = eventQueue_.rend();
-
-    for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
-      if (it->type == rawEvent.type &&
-          it->eventTarget == rawEvent.eventTarget) {
-        repeatedEvent = it;
-        break;
-      } else if (it->eventTarget == rawEvent.eventTarget) {
-        // It is necessary to maintain order of different event types
-        // for the same target. If the same target has event types A1, B1
-        // in the event queue and event A2 occurs. A1 has to stay in the
-        // queue.
-        break;
-      }
-    }
-
-    if (repeatedEvent == eventQueue_.rend()) {
-      eventQueue_.push_back(std::move(rawEvent));
-    } else {
-      *repeatedEvent = std::move(rawEvent);
-    }
-  }
+  eventQueue_.push({std::move(rawEvent), /* isUnique = */ true});
 
   onEnqueue();
 }
 
 void EventQueue::enqueueStateUpdate(StateUpdate &&stateUpdate) const {
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    if (!stateUpdateQueue_.empty()) {
-      auto const position = stateUpdateQueue_.back();
-      if (stateUpdate.family == position.family) {
-        stateUpdateQueue_.pop_back();
-      }
-    }
-    stateUpdateQueue_.push_back(std::move(stateUpdate));
-  }
+  stateUpdateQueue_.push(std::move(stateUpdate));
 
   onEnqueue();
 }
@@ -81,34 +48,70 @@ void EventQueue::onBeat(jsi::Runtime &runtime) const {
 }
 
 void EventQueue::flushEvents(jsi::Runtime &runtime) const {
-  std::vector<RawEvent> queue;
+  auto queuedEvents = eventQueue_.popAll();
 
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
+  if (queuedEvents.empty()) {
+    return;
+  }
+
+  auto hasUniqueEvents = std::any_of(
+      queuedEvents.begin(),
+      queuedEvents.end(),
+      [](QueuedEvent const &queuedEvent) { return queuedEvent.isUnique; });
 
-    if (eventQueue_.empty()) {
-      return;
+  std::vector<RawEvent> queue;
+  queue.reserve(queuedEvents.size());
+
+  if (!hasUniqueEvents) {
+    for (auto &queuedEvent : queuedEvents) {
+      queue.push_back(std::move(queuedEvent.rawEvent));
     }
+  } else {
+    // Index of the last event in `queue` for every event target.
+    // It is necessary to maintain order of different event types for the same
+    // target: if the same target has event types A1, B1 in the queue and
+    // event A2 occurs, A1 has to stay in the queue. So a unique event only
+    // replaces the last event of its target, and only if types match.
+    auto lastEventIndices = std::unordered_map<EventTarget const *, size_t>{};
+    lastEventIndices.reserve(queuedEvents.size());
+
+    for (auto &queuedEvent : queuedEvents) {
+      auto &rawEvent = queuedEvent.rawEvent;
+      auto eventTarget = rawEvent.eventTarget.get();
+
+      if (queuedEvent.isUnique) {
+        auto it = lastEventIndices.find(eventTarget);
+        if (it != lastEventIndices.end() &&
+            queue[it->second].type == rawEvent.type) {
+          queue[it->second] = std::move(rawEvent);
+          continue;
+        }
+      }
 
-    queue = std::move(eventQueue_);
-    eventQueue_.clear();
+      lastEventIndices[eventTarget] = queue.size();
+      queue.push_back(std::move(rawEvent));
+    }
   }
 
   eventProcessor_.flushEvents(runtime, std::move(queue));
 }
 
 void EventQueue::flushStateUpdates() const {
-  std::vector<StateUpdate> stateUpdateQueue;
+  auto queuedStateUpdates = stateUpdateQueue_.popAll();
 
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
+  if (queuedStateUpdates.empty()) {
+    return;
+  }
 
-    if (stateUpdateQueue_.empty()) {
-      return;
+  // Consecutive updates of the same family are collapsed into the last one.
+  std::vector<StateUpdate> stateUpdateQueue;
+  stateUpdateQueue.reserve(queuedStateUpdates.size());
+  for (auto &stateUpdate : queuedStateUpdates) {
+    if (!stateUpdateQueue.empty() &&
+        stateUpdateQueue.back().family == stateUpdate.family) {
+      stateUpdateQueue.pop_back();
     }
-
-    stateUpdateQueue = std::move(stateUpdateQueue_);
-    stateUpdateQueue_.clear();
+    stateUpdateQueue.push_back(std::move(stateUpdate));
   }
 
   eventProcessor_.flushStateUpdates(std::move(stateUpdateQueue));
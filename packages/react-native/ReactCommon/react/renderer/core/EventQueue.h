@@ -8,12 +8,12 @@
 #pragma once
 
 #include <memory>
-#include <mutex>
 #include <vector>
 
 #include <jsi/jsi.h>
 #include <react/renderer/core/EventBeat.h>
 #include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/MultiProducerQueue.h>
 #include <react/renderer/core/RawEvent.h>
 #include <react/renderer/core/StateUpdate.h>
 
@@ -39,7 +39,7 @@ class EventQueue {
 
   /*
    * Enqueues and (probably later) dispatches a given event.
-   * Deletes last RawEvent from the queue if it has the same type and target.
+   * Replaces last RawEvent in the queue if it has the same type and target.
    * Can be called on any thread.
    */
   void enqueueUniqueEvent(RawEvent &&rawEvent) const;
@@ -65,10 +65,20 @@ class EventQueue {
   EventQueueProcessor eventProcessor_;
 
   const std::unique_ptr<EventBeat> eventBeat_;
-  // Thread-safe, protected by `queueMutex_`.
-  mutable std::vector<RawEvent> eventQueue_;
-  mutable std::vector<StateUpdate> stateUpdateQueue_;
-  mutable std::mutex queueMutex_;
+
+  /*
+   * An event which is waiting to be flushed. Unique events replace the last
+   * queued event of the same target if it has the same type; this is done
+   * during flushing, so enqueueing never needs to inspect the queue.
+   */
+  struct QueuedEvent {
+    RawEvent rawEvent;
+    bool isUnique;
+  };
+
+  // Thread-safe, lock-free.
+  mutable MultiProducerQueue<QueuedEvent> eventQueue_;
+  mutable MultiProducerQueue<StateUpdate> stateUpdateQueue_;
   mutable bool hasContinuousEventStarted_{false};
 };
 
@@ -21,13 +21,9 @@ EventQueueProcessor::EventQueueProcessor(
 void EventQueueProcessor::flushEvents(
     jsi::Runtime &runtime,
     std::vector<RawEvent> &&events) const {
-  {
-    std::lock_guard<std::mutex> lock(EventEmitter::DispatchMutex());
-
-    for (const auto &event : events) {
-      if (event.eventTarget) {
-        event.eventTarget->retain(runtime);
-      }
+  for (const auto &event : events) {
+    if (event.eventTarget) {
+      event.eventTarget->retain(runtime);
     }
   }
 
@@ -69,10 +65,8 @@ void EventQueueProcessor::flushEvents(
     }
   }
 
-  // No need to lock `EventEmitter::DispatchMutex()` here.
-  // The mutex protects from a situation when the `instanceHandle` can be
-  // deallocated during accessing, but that's impossible at this point because
-  // we have a strong pointer to it.
+  // The `instanceHandle` cannot be deallocated at this point because we have
+  // a strong pointer to it.
   for (const auto &event : events) {
     if (event.eventTarget) {
       event.eventTarget->release(runtime);
@@ -23,11 +23,11 @@ EventTarget::EventTarget(
       tag_(tag) {}
 
 void EventTarget::setEnabled(bool enabled) const {
-  enabled_ = enabled;
+  enabled_.store(enabled, std::memory_order_release);
 }
 
 void EventTarget::retain(jsi::Runtime &runtime) const {
-  if (!enabled_) {
+  if (!enabled_.load(std::memory_order_acquire)) {
     return;
   }
 
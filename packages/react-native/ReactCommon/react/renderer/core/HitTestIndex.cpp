@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "HitTestIndex.h"
+
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/core/TraitCast.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace facebook::react {
+
+// Nodes with fewer children are hit-tested without a grid.
+static constexpr size_t kMinNumberOfChildrenForGrid = 16;
+
+// Maximum number of columns (and rows) of a grid.
+static constexpr int kMaxGridDimension = 32;
+
+// A grid is not built if children overlap so much that the total number of
+// cell items would exceed this number multiplied by the number of children.
+static constexpr size_t kMaxCellItemsPerChild = 8;
+
+struct HitTestIndex::Entry final {
+  // Indices of layoutable children in hit-testing order.
+  std::vector<uint32_t> order;
+
+  // The grid; empty `cellOffsets` means that there is no grid.
+  // Items of every cell are indices of children in hit-testing order.
+  Rect bounds;
+  int columns{0};
+  int rows{0};
+  std::vector<uint32_t> cellOffsets;
+  std::vector<uint32_t> cellItems;
+
+  int getColumn(Float x) const {
+    return getCell(x, bounds.origin.x, bounds.size.width, columns);
+  }
+
+  int getRow(Float y) const {
+    return getCell(y, bounds.origin.y, bounds.size.height, rows);
+  }
+
+  static int getCell(Float value, Float origin, Float size, int count) {
+    if (size <= 0) {
+      return 0;
+    }
+    // The function is monotonic, so a point inside of a rect is always
+    // mapped to a cell in the range of cells of the rect.
+    auto cell = std::floor((value - origin) / size * count);
+    return static_cast<int>(std::clamp(cell, Float{0}, Float(count - 1)));
+  }
+};
+
+HitTestIndex::HitTestIndex() = default;
+
+HitTestIndex::~HitTestIndex() = default;
+
+static bool isFinite(Rect const &rect) {
+  return std::isfinite(rect.origin.x) && std::isfinite(rect.origin.y) &&
+      std::isfinite(rect.size.width) && std::isfinite(rect.size.height);
+}
+
+HitTestIndex::Candidates HitTestIndex::getCandidates(
+    ShadowNode const &shadowNode,
+    Point point) const {
+  auto const &entry = getEntry(shadowNode);
+
+  if (entry.cellOffsets.empty()) {
+    return {entry.order.data(), entry.order.data() + entry.order.size()};
+  }
+
+  auto isPointInsideBounds = point.x >= entry.bounds.getMinX() &&
+      point.x <= entry.bounds.getMaxX() && point.y >= entry.bounds.getMinY() &&
+      point.y <= entry.bounds.getMaxY();
+  if (!isPointInsideBounds) {
+    // None of the children contains the point.
+    return {nullptr, nullptr};
+  }
+
+  auto cell = entry.getRow(point.y) * entry.columns + entry.getColumn(point.x);
+  auto items = entry.cellItems.data();
+  return {items + entry.cellOffsets[cell], items + entry.cellOffsets[cell + 1]};
+}
+
+HitTestIndex::Entry const &HitTestIndex::getEntry(
+    ShadowNode const &shadowNode) const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(&shadowNode);
+    if (it != entries_.end()) {
+      return *it->second;
+    }
+  }
+
+  // Building the entry without holding the lock; if some other thread builds
+  // an entry for the same node concurrently, the first one wins.
+  auto entry = buildEntry(shadowNode);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return *entries_.emplace(&shadowNode, std::move(entry)).first->second;
+}
+
+std::unique_ptr<HitTestIndex::Entry const> HitTestIndex::buildEntry(
+    ShadowNode const &shadowNode) {
+  auto entry = std::make_unique<Entry>();
+  auto const &children = shadowNode.getChildren();
+
+  auto frames = std::vector<Rect>{};
+  frames.reserve(children.size());
+  entry->order.reserve(children.size());
+
+  for (uint32_t index = 0; index < children.size(); index++) {
+    auto layoutableChildShadowNode =
+        traitCast<LayoutableShadowNode const *>(children[index].get());
+    if (layoutableChildShadowNode == nullptr) {
+      frames.emplace_back();
+      continue;
+    }
+    entry->order.push_back(index);
+    frames.push_back(
+        layoutableChildShadowNode->getLayoutMetrics().frame *
+        layoutableChildShadowNode->getTransform());
+  }
+
+  // Same order as `std::stable_sort` by order index followed by reverse
+  // iteration.
+  std::stable_sort(
+      entry->order.begin(),
+      entry->order.end(),
+      [&](uint32_t lhs, uint32_t rhs) {
+        return children[lhs]->getOrderIndex() <
+            children[rhs]->getOrderIndex();
+      });
+  std::reverse(entry->order.begin(), entry->order.end());
+
+  if (entry->order.size() < kMinNumberOfChildrenForGrid) {
+    return entry;
+  }
+
+  auto minX = std::numeric_limits<Float>::max();
+  auto minY = std::numeric_limits<Float>::max();
+  auto maxX = std::numeric_limits<Float>::lowest();
+  auto maxY = std::numeric_limits<Float>::lowest();
+  for (auto index : entry->order) {
+    auto const &frame = frames[index];
+    if (!isFinite(frame)) {
+      // Such frames can not be placed into a grid.
+      return entry;
+    }
+    minX = std::min(minX, frame.getMinX());
+    minY = std::min(minY, frame.getMinY());
+    maxX = std::max(maxX, frame.getMaxX());
+    maxY = std::max(maxY, frame.getMaxY());
+  }
+
+  auto dimension = std::clamp(
+      static_cast<int>(std::sqrt(entry->order.size())), 1, kMaxGridDimension);
+
+  entry->bounds = Rect{{minX, minY}, {maxX - minX, maxY - minY}};
+  entry->columns = dimension;
+  entry->rows = dimension;
+
+  // Counting items of every cell first.
+  auto cellCount = static_cast<size_t>(entry->columns * entry->rows);
+  auto cellOffsets = std::vector<uint32_t>(cellCount + 1, 0);
+  size_t numberOfItems = 0;
+  for (auto index : entry->order) {
+    auto const &frame = frames[index];
+    auto columnCount = entry->getColumn(frame.getMaxX()) -
+        entry->getColumn(frame.getMinX()) + 1;
+    auto rowCount =
+        entry->getRow(frame.getMaxY()) - entry->getRow(frame.getMinY()) + 1;
+    numberOfItems += static_cast<size_t>(columnCount * rowCount);
+  }
+
+  if (numberOfItems > entry->order.size() * kMaxCellItemsPerChild) {
+    // Children overlap too much; the grid would not help.
+    return entry;
+  }
+
+  for (auto index : entry->order) {
+    auto const &frame = frames[index];
+    for (auto row = entry->getRow(frame.getMinY());
+         row <= entry->getRow(frame.getMaxY());
+         row++) {
+      for (auto column = entry->getColumn(frame.getMinX());
+           column <= entry->getColumn(frame.getMaxX());
+           column++) {
+        cellOffsets[row * entry->columns + column + 1]++;
+      }
+    }
+  }
+
+  std::partial_sum(cellOffsets.begin(), cellOffsets.end(), cellOffsets.begin());
+
+  // Filling cells in hit-testing order, so items of every cell are sorted.
+  auto cellItems = std::vector<uint32_t>(numberOfItems);
+  auto cursors =
+      std::vector<uint32_t>(cellOffsets.begin(), cellOffsets.end() - 1);
+  for (auto index : entry->order) {
+    auto const &frame = frames[index];
+    for (auto row = entry->getRow(frame.getMinY());
+         row <= entry->getRow(frame.getMaxY());
+         row++) {
+      for (auto column = entry->getColumn(frame.getMinX());
+           column <= entry->getColumn(frame.getMaxX());
+           column++) {
+        cellItems[cursors[row * entry->columns + column]++] = index;
+      }
+    }
+  }
+
+  entry->cellOffsets = std::move(cellOffsets);
+  entry->cellItems = std::move(cellItems);
+  return entry;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/graphics/Point.h>
+#include <react/renderer/graphics/Rect.h>
+
+namespace facebook {
+namespace react {
+
+class ShadowNode;
+
+/*
+ * Speeds up `LayoutableShadowNode::findNodeAtPoint` on an immutable
+ * (committed) tree.
+ * For every node visited during hit-testing, the index memoizes the list of
+ * its layoutable children in hit-testing order (sorted by order index,
+ * topmost first). For nodes with many children it also builds a uniform grid
+ * over transformed frames of the children, so only children whose frames
+ * overlap the cell containing the point are tested.
+ *
+ * Nodes are identified by their addresses, so the index must only be used
+ * with nodes of the tree it was created for, while the tree is retained.
+ * Thread-safe.
+ */
+class HitTestIndex final {
+ public:
+  HitTestIndex();
+  ~HitTestIndex();
+
+  /*
+   * Not copyable.
+   */
+  HitTestIndex(HitTestIndex const &other) = delete;
+  HitTestIndex &operator=(HitTestIndex const &other) = delete;
+
+  /*
+   * A range of indices of children in the children list of a node.
+   */
+  class Candidates final {
+   public:
+    Candidates(uint32_t const *begin, uint32_t const *end)
+        : begin_(begin), end_(end) {}
+
+    uint32_t const *begin() const {
+      return begin_;
+    }
+
+    uint32_t const *end() const {
+      return end_;
+    }
+
+   private:
+    uint32_t const *begin_;
+    uint32_t const *end_;
+  };
+
+  /*
+   * Returns indices of children of `shadowNode` which might contain `point`
+   * (in the coordinate space of the children), in the order in which they
+   * must be hit-tested. Children whose transformed frames do not contain
+   * the point can be omitted; non-layoutable children are always omitted.
+   */
+  Candidates getCandidates(ShadowNode const &shadowNode, Point point) const;
+
+ private:
+  struct Entry;
+
+  Entry const &getEntry(ShadowNode const &shadowNode) const;
+
+  static std::unique_ptr<Entry const> buildEntry(ShadowNode const &shadowNode);
+
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<ShadowNode const *, std::unique_ptr<Entry const>>
+      entries_;
+};
+
+} // namespace react
+} // namespace facebook
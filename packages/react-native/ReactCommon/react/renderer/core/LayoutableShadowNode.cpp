@@ -7,6 +7,7 @@
 
 #include "LayoutableShadowNode.h"
 
+#include <react/renderer/core/HitTestIndex.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutMetrics.h>
@@ -87,7 +88,8 @@ LayoutableShadowNode::LayoutableShadowNode(
 LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
     ShadowNodeFamily const &descendantNodeFamily,
     LayoutableShadowNode const &ancestorNode,
-    LayoutInspectingPolicy policy) {
+    LayoutInspectingPolicy policy,
+    AncestorIndex const *ancestorIndex) {
   // Prelude.
 
   if (&descendantNodeFamily == &ancestorNode.getFamily()) {
@@ -104,7 +106,8 @@ LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
     return layoutMetrics;
   }
 
-  auto ancestors = descendantNodeFamily.getAncestors(ancestorNode);
+  auto ancestors =
+      descendantNodeFamily.getAncestors(ancestorNode, ancestorIndex);
 
   if (ancestors.empty()) {
     // Specified nodes do not form an ancestor-descender relationship
@@ -297,7 +300,8 @@ Float LayoutableShadowNode::lastBaseline(Size /*size*/) const {
 
 ShadowNode::Shared LayoutableShadowNode::findNodeAtPoint(
     ShadowNode::Shared const &node,
-    Point point) {
+    Point point,
+    HitTestIndex const *hitTestIndex) {
   auto layoutableShadowNode =
       traitCast<const LayoutableShadowNode *>(node.get());
 
@@ -315,6 +319,18 @@ ShadowNode::Shared LayoutableShadowNode::findNodeAtPoint(
   auto newPoint = point - transformedFrame.origin -
       layoutableShadowNode->getContentOriginOffset();
 
+  if (hitTestIndex != nullptr) {
+    auto const &children = node->getChildren();
+    for (auto childIndex : hitTestIndex->getCandidates(*node, newPoint)) {
+      auto hitView =
+          findNodeAtPoint(children[childIndex], newPoint, hitTestIndex);
+      if (hitView) {
+        return hitView;
+      }
+    }
+    return node;
+  }
+
   auto sortedChildren = node->getChildren();
   std::stable_sort(
       sortedChildren.begin(),
@@ -23,6 +23,7 @@
 namespace facebook {
 namespace react {
 
+class HitTestIndex;
 struct LayoutConstraints;
 struct LayoutContext;
 
@@ -56,12 +57,14 @@ class LayoutableShadowNode : public ShadowNode {
    * Returns layout metrics of a node represented as `descendantNodeFamily`
    * computed relatively to given `ancestorNode`. Returns `EmptyLayoutMetrics`
    * if the nodes don't form an ancestor-descender relationship in the same
-   * tree.
+   * tree. `ancestorIndex` (optional) is used to find the chain of nodes
+   * between the two nodes.
    */
   static LayoutMetrics computeRelativeLayoutMetrics(
       ShadowNodeFamily const &descendantNodeFamily,
       LayoutableShadowNode const &ancestorNode,
-      LayoutInspectingPolicy policy);
+      LayoutInspectingPolicy policy,
+      AncestorIndex const *ancestorIndex = nullptr);
 
   /*
    * Performs layout of the tree starting from this node. Usually is being
@@ -130,11 +133,13 @@ class LayoutableShadowNode : public ShadowNode {
 
   /*
    * Returns the ShadowNode that is rendered at the Point received as a
-   * parameter.
+   * parameter. `hitTestIndex` (optional) is used to find children which
+   * might contain the point.
    */
   static ShadowNode::Shared findNodeAtPoint(
       ShadowNode::Shared const &node,
-      Point point);
+      Point point,
+      HitTestIndex const *hitTestIndex = nullptr);
 
   /*
    * Clean or Dirty layout state:
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Unbounded lock-free queue which can be filled from any number of threads
+ * concurrently and drained all at once.
+ *
+ * Producers prepend values to an intrusive singly-linked list with a single
+ * compare-and-swap; a consumer detaches the whole list with one atomic
+ * exchange and restores the order in which the values were pushed.
+ * Because nodes are never removed one by one, the queue is not prone to the
+ * ABA problem.
+ */
+template <typename T>
+class MultiProducerQueue final {
+ public:
+  MultiProducerQueue() = default;
+
+  ~MultiProducerQueue() {
+    auto node = head_.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr) {
+      auto next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+  /*
+   * Not copyable, not movable.
+   */
+  MultiProducerQueue(MultiProducerQueue const &other) = delete;
+  MultiProducerQueue &operator=(MultiProducerQueue const &other) = delete;
+
+  /*
+   * Adds a value to the end of the queue.
+   * Can be called on any thread.
+   */
+  void push(T &&value) {
+    auto node =
+        new Node{std::move(value), head_.load(std::memory_order_relaxed)};
+    while (!head_.compare_exchange_weak(
+        node->next,
+        node,
+        std::memory_order_release,
+        std::memory_order_relaxed)) {
+    }
+  }
+
+  /*
+   * Removes all values from the queue and returns them in the order in which
+   * they were pushed.
+   * Can be called on any thread; concurrent calls receive disjoint sets of
+   * values.
+   */
+  std::vector<T> popAll() {
+    auto node = head_.exchange(nullptr, std::memory_order_acquire);
+
+    // The list is in the reverse order, reverse it back.
+    Node *reversed = nullptr;
+    size_t count = 0;
+    while (node != nullptr) {
+      auto next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+      count++;
+    }
+
+    auto values = std::vector<T>{};
+    values.reserve(count);
+    while (reversed != nullptr) {
+      auto next = reversed->next;
+      values.push_back(std::move(reversed->value));
+      delete reversed;
+      reversed = next;
+    }
+    return values;
+  }
+
+  /*
+   * Returns `true` if the queue was empty at some moment during the call.
+   */
+  bool empty() const {
+    return head_.load(std::memory_order_relaxed) == nullptr;
+  }
+
+ private:
+  struct Node {
+    T value;
+    Node *next;
+  };
+
+  std::atomic<Node *> head_{nullptr};
+};
+
+} // namespace react
+} // namespace facebook
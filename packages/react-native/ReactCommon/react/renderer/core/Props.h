@@ -9,6 +9,7 @@
 
 #include <folly/dynamic.h>
 
+#include <react/renderer/core/DynamicPropsChain.h>
 #include <react/renderer/core/PropsMacros.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawProps.h>
@@ -57,7 +58,11 @@ class Props : public virtual Sealable, public virtual DebugStringConvertible {
   std::string nativeId;
 
 #ifdef ANDROID
-  folly::dynamic rawProps = folly::dynamic::object();
+  /*
+   * Props as they came from JavaScript, which the mounting layer sends to the
+   * platform. Shared between clones instead of being copied.
+   */
+  DynamicPropsChain rawProps{};
 
   virtual void propsDiffMapBuffer(
       Props const *oldProps,
@@ -100,4 +100,17 @@ void RawProps::iterateOverValues(
   return parser_->iterateOverValues(*this, fn);
 }
 
+RawProps::Group::Group(RawProps const &rawProps, char const *name) noexcept
+    : rawProps_(rawProps), name_(name) {
+  if (rawProps_.parser_ != nullptr) {
+    rawProps_.parser_->beginGroup(rawProps_, name_);
+  }
+}
+
+RawProps::Group::~Group() noexcept {
+  if (rawProps_.parser_ != nullptr) {
+    rawProps_.parser_->endGroup(rawProps_, name_);
+  }
+}
+
 } // namespace facebook::react
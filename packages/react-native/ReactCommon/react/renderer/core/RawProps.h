@@ -44,6 +44,28 @@ class RawProps final {
    */
   enum class Mode { Empty, JSI, Dynamic };
 
+  /*
+   * Marks the props requested during the lifetime of the object as a group
+   * (e.g. all Yoga style props). If none of the props of the group has a
+   * value, requesting them does not involve any lookups: `at` returns
+   * `nullptr` right away, so the source values are used as-is.
+   * A group must request its props in the same order every time and must
+   * not request props which were requested before it.
+   * The `name` identifies the group and must outlive the object.
+   */
+  class Group final {
+   public:
+    Group(RawProps const &rawProps, char const *name) noexcept;
+    ~Group() noexcept;
+
+    Group(Group const &other) = delete;
+    Group &operator=(Group const &other) = delete;
+
+   private:
+    RawProps const &rawProps_;
+    char const *name_;
+  };
+
   /*
    * Creates empty RawProps objects.
    */
@@ -130,6 +152,12 @@ class RawProps final {
    */
   mutable int keyIndexCursor_{0};
 
+  /*
+   * The name of the group of props which is being skipped since none of its
+   * props has a value (see `Group`), or `nullptr`.
+   */
+  mutable char const *skippedGroupName_{nullptr};
+
   /*
    * Parsed artefacts:
    * To be used by `RawPropParser`.
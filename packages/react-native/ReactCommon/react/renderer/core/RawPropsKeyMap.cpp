@@ -13,9 +13,101 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace facebook::react {
 
+static constexpr uint16_t kEmptySlot = std::numeric_limits<uint16_t>::max();
+
+/*
+ * Hashes the name eight bytes at a time. The last chunk overlaps the previous
+ * one instead of being copied byte by byte; names shorter than eight bytes
+ * are read as two (possibly overlapping) four-byte halves.
+ */
+static uint64_t hashName(char const *name, size_t length) noexcept {
+  auto hash = uint64_t{length} * 0x9e3779b97f4a7c15ULL;
+  auto chunk = uint64_t{0};
+  if (length >= 8) {
+    for (size_t i = 0; i + 8 < length; i += 8) {
+      std::memcpy(&chunk, name + i, 8);
+      hash = (hash ^ chunk) * 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 32;
+    }
+    std::memcpy(&chunk, name + length - 8, 8);
+  } else if (length >= 4) {
+    auto low = uint32_t{0};
+    auto high = uint32_t{0};
+    std::memcpy(&low, name, 4);
+    std::memcpy(&high, name + length - 4, 4);
+    chunk = (uint64_t{high} << 32) | low;
+  } else {
+    for (size_t i = 0; i < length; i++) {
+      chunk |= uint64_t{static_cast<uint8_t>(name[i])} << (8 * i);
+    }
+  }
+  hash = (hash ^ chunk) * 0xff51afd7ed558ccdULL;
+  return hash ^ (hash >> 32);
+}
+
+/*
+ * Combines `hash` with `seed`; a single multiplication by an odd number
+ * derived from the seed is enough since only the high bits are used.
+ */
+static uint64_t mixHash(uint64_t hash, uint64_t seed) noexcept {
+  return (hash ^ (seed << 32)) * (seed * 0x9e3779b97f4a7c16ULL + 1);
+}
+
+/*
+ * Maps `hash` to `[0, range)` without a division.
+ */
+static size_t reduce(uint64_t hash, size_t range) noexcept {
+  return static_cast<size_t>(((hash >> 32) * range) >> 32);
+}
+
+/*
+ * Compares `length` bytes of the names sixteen at a time where SIMD is
+ * available. Prop names are short, so this beats calling `memcmp`.
+ */
+static bool areNamesEqual(
+    char const *lhs,
+    char const *rhs,
+    size_t length) noexcept {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= length; i += 16) {
+    auto equal = _mm_cmpeq_epi8(
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(lhs + i)),
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(rhs + i)));
+    if (_mm_movemask_epi8(equal) != 0xFFFF) {
+      return false;
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 16 <= length; i += 16) {
+    auto equal = vceqq_u8(
+        vld1q_u8(reinterpret_cast<uint8_t const *>(lhs + i)),
+        vld1q_u8(reinterpret_cast<uint8_t const *>(rhs + i)));
+    if (vminvq_u8(equal) != 0xFF) {
+      return false;
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (lhs[i] != rhs[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool RawPropsKeyMap::hasSameName(Item const &lhs, Item const &rhs) noexcept {
   return lhs.length == rhs.length &&
       (std::memcmp(lhs.name, rhs.name, lhs.length) == 0);
@@ -59,48 +151,93 @@ void RawPropsKeyMap::reindex() noexcept {
       std::unique(items_.begin(), items_.end(), &RawPropsKeyMap::hasSameName),
       items_.end());
 
-  buckets_.resize(kPropNameLengthHardCap);
+  // A minimal perfect hash (one slot per item) is found almost always; in
+  // the unlikely case it's not, adding a few empty slots helps.
+  auto slotCount = std::max(items_.size(), size_t{1});
+  while (!buildPerfectHash(slotCount)) {
+    slotCount += slotCount / 8 + 1;
+  }
+}
+
+bool RawPropsKeyMap::buildPerfectHash(size_t slotCount) noexcept {
+  // On average, four items share a seed.
+  auto seedCount = items_.size() / 4 + 1;
+  seeds_.assign(seedCount, 0);
+  slots_.assign(slotCount, kEmptySlot);
 
-  auto length = RawPropsPropNameLength{0};
+  auto hashes = std::vector<uint64_t>(items_.size());
+  auto buckets = std::vector<std::vector<uint16_t>>(seedCount);
   for (size_t i = 0; i < items_.size(); i++) {
-    auto &item = items_[i];
-    if (item.length != length) {
-      for (auto j = length; j < item.length; j++) {
-        buckets_[j] = static_cast<RawPropsPropNameLength>(i);
+    hashes[i] = hashName(items_[i].name, items_[i].length);
+    buckets[reduce(hashes[i], seedCount)].push_back(
+        static_cast<uint16_t>(i));
+  }
+
+  // Placing the biggest buckets first, while most of the slots are free.
+  auto order = std::vector<size_t>(seedCount);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return buckets[lhs].size() > buckets[rhs].size();
+  });
+
+  auto bucketSlots = std::vector<size_t>{};
+  for (auto bucketIndex : order) {
+    auto const &bucket = buckets[bucketIndex];
+    if (bucket.empty()) {
+      break;
+    }
+
+    auto placed = false;
+    for (uint32_t seed = 1; seed < kEmptySlot && !placed; seed++) {
+      bucketSlots.clear();
+      placed = true;
+      for (auto itemIndex : bucket) {
+        auto slot = reduce(mixHash(hashes[itemIndex], seed), slotCount);
+        if (slots_[slot] != kEmptySlot ||
+            std::find(bucketSlots.begin(), bucketSlots.end(), slot) !=
+                bucketSlots.end()) {
+          placed = false;
+          break;
+        }
+        bucketSlots.push_back(slot);
+      }
+      if (placed) {
+        seeds_[bucketIndex] = static_cast<uint16_t>(seed);
+        for (size_t i = 0; i < bucket.size(); i++) {
+          slots_[bucketSlots[i]] = bucket[i];
+        }
       }
-      length = item.length;
     }
-  }
 
-  for (auto j = length; j < buckets_.size(); j++) {
-    buckets_[j] = static_cast<RawPropsPropNameLength>(items_.size());
+    if (!placed) {
+      return false;
+    }
   }
+
+  return true;
 }
 
 RawPropsValueIndex RawPropsKeyMap::at(
     char const *name,
-    RawPropsPropNameLength length) noexcept {
+    RawPropsPropNameLength length) const noexcept {
   react_native_assert(length > 0);
   react_native_assert(length < kPropNameLengthHardCap);
-  // 1. Find the bucket.
-  auto lower = int{buckets_[length - 1]};
-  auto upper = int{buckets_[length]} - 1;
-  react_native_assert(lower - 1 <= upper);
-
-  // 2. Binary search in the bucket.
-  while (lower <= upper) {
-    auto median = (lower + upper) / 2;
-    auto condition = std::memcmp(items_[median].name, name, length);
-    if (condition < 0) {
-      lower = median + 1;
-    } else if (condition == 0) {
-      return items_[median].value;
-    } else /* if (condition > 0) */ {
-      upper = median - 1;
-    }
+  if (seeds_.empty()) {
+    return kRawPropsValueIndexEmpty;
   }
 
-  return kRawPropsValueIndexEmpty;
+  auto hash = hashName(name, length);
+  auto seed = seeds_[reduce(hash, seeds_.size())];
+  auto itemIndex = slots_[reduce(mixHash(hash, seed), slots_.size())];
+  if (itemIndex == kEmptySlot) {
+    return kRawPropsValueIndexEmpty;
+  }
+
+  auto const &item = items_[itemIndex];
+  if (item.length != length || !areNamesEqual(item.name, name, length)) {
+    return kRawPropsValueIndexEmpty;
+  }
+  return item.value;
 }
 
 } // namespace facebook::react
@@ -17,10 +17,11 @@ namespace react {
 
 /*
  * A map especially optimized to hold `{name: index}` relations.
- * The implementation is conceptually similar to a classic hash map with a hash
- * function that returns the length of the string.
- * The map is optimized for reads only (the map must be reindexed before a bunch
- * of reads).
+ * The set of names is known in advance (the map must be reindexed before a
+ * bunch of reads), so reindexing builds a minimal perfect hash function for
+ * it (using the "hash, displace" approach): every name maps to its own slot,
+ * and a lookup takes hashing the name and comparing it with the one stored
+ * in the slot.
  */
 class RawPropsKeyMap final {
  public:
@@ -39,9 +40,8 @@ class RawPropsKeyMap final {
    * Finds and returns the `value` (some index) by given `key`.
    * Returns `kRawPropsValueIndexEmpty` if the value wan't found.
    */
-  RawPropsValueIndex at(
-      char const *name,
-      RawPropsPropNameLength length) noexcept;
+  RawPropsValueIndex at(char const *name, RawPropsPropNameLength length)
+      const noexcept;
 
  private:
   struct Item {
@@ -55,9 +55,20 @@ class RawPropsKeyMap final {
       Item const &rhs) noexcept;
   static bool hasSameName(Item const &lhs, Item const &rhs) noexcept;
 
+  /*
+   * Tries to find seeds which map every item to a distinct slot out of
+   * `slotCount`; fills `seeds_` and `slots_` and returns `true` on success.
+   */
+  bool buildPerfectHash(size_t slotCount) noexcept;
+
   butter::small_vector<Item, kNumberOfExplicitlySpecifedPropsSoftCap> items_{};
-  butter::small_vector<RawPropsPropNameLength, kPropNameLengthHardCap>
-      buckets_{};
+
+  /*
+   * The first-level hash of a name selects a seed, the name hashed with the
+   * seed selects a slot, which holds an index in `items_`.
+   */
+  butter::small_vector<uint16_t, kNumberOfPropsPerComponentSoftCap> seeds_{};
+  butter::small_vector<uint16_t, kNumberOfPropsPerComponentSoftCap> slots_{};
 };
 
 } // namespace react
@@ -14,6 +14,10 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 namespace facebook::react {
 
 // During parser initialization, Props structs are used to parse
@@ -36,6 +40,13 @@ RawValue const *RawPropsParser::at(
     size_t size = keys_.size();
     for (int i = 0; i < size; i++) {
       if (keys_[i] == key) {
+        // The key belongs to whatever was requesting it first; a group which
+        // requests it again can't tell whether it has values by its range.
+        for (auto &group : groups_) {
+          if (group.end == -1 && group.begin > i) {
+            group.isSkippable = false;
+          }
+        }
         return nullptr;
       }
     }
@@ -49,44 +60,104 @@ RawValue const *RawPropsParser::at(
   // Normally, keys are looked up in-order. For performance we can simply
   // increment this key counter, and if the key is equal to the key at the next
   // index, there's no need to do any lookups. However, it's possible for keys
-  // to be accessed out-of-order or multiple times, in which case we start
-  // searching again from index 0.
-  // To prevent infinite loops (which can occur if
-  // you look up a key that doesn't exist) we keep track of whether or not we've
-  // already looped around, and log and return nullptr if so. However, we ONLY
-  // do this in debug mode, where you're more likely to look up a nonexistent
-  // key as part of debugging. You can (and must) ensure infinite loops are not
-  // possible in production by: (1) constructing all props objects without
-  // conditionals, or (2) if there are conditionals, ensure that in the parsing
-  // setup case, the Props constructor will access _all_ possible props. To
-  // ensure this performance optimization is utilized, always access props in
-  // the same order every time. This is trivial if you have a simple Props
-  // constructor, but difficult or impossible if you have a shared sub-prop
-  // Struct that is used by multiple parent Props.
-#ifdef REACT_NATIVE_DEBUG
-  bool resetLoop = false;
-#endif
-  do {
-    rawProps.keyIndexCursor_++;
+  // to be accessed out-of-order or multiple times (e.g. by shared sub-prop
+  // structs), in which case the key is looked up by its name in
+  // `nameToIndex_`, which takes constant time too.
+  if (UNLIKELY(keys_.empty() || rawProps.skippedGroupName_ != nullptr)) {
+    return nullptr;
+  }
 
-    if (UNLIKELY(rawProps.keyIndexCursor_ >= keys_.size())) {
+  auto keyIndex = rawProps.keyIndexCursor_ + 1;
+  if (UNLIKELY(keyIndex >= static_cast<int>(keys_.size()))) {
+    keyIndex = 0;
+  }
+
+  if (UNLIKELY(key != keys_[keyIndex])) {
+    auto name = std::array<char, kPropNameLengthHardCap>();
+    auto length = RawPropsPropNameLength{0};
+    key.render(name.data(), &length);
+    auto index = nameToIndex_.at(name.data(), length);
+
+    // Keys with the same name but different fragments are different keys,
+    // which can't have a value (see `RawPropsKeyMap::reindex`).
+    if (index == kRawPropsValueIndexEmpty || key != keys_[index]) {
 #ifdef REACT_NATIVE_DEBUG
-      if (resetLoop) {
+      if (index == kRawPropsValueIndexEmpty) {
         LOG(ERROR) << "Looked up RawProps key that does not exist: "
                    << (std::string)key;
-        return nullptr;
       }
-      resetLoop = true;
 #endif
-      rawProps.keyIndexCursor_ = 0;
+      return nullptr;
     }
-  } while (UNLIKELY(key != keys_[rawProps.keyIndexCursor_]));
+    keyIndex = index;
+  }
 
+  rawProps.keyIndexCursor_ = keyIndex;
   auto valueIndex = rawProps.keyIndexToValueIndex_[rawProps.keyIndexCursor_];
   return valueIndex == kRawPropsValueIndexEmpty ? nullptr
                                                 : &rawProps.values_[valueIndex];
 }
 
+void RawPropsParser::beginGroup(RawProps const &rawProps, char const *name)
+    const noexcept {
+  auto group = std::find_if(
+      groups_.begin(), groups_.end(), [&](GroupRange const &group) {
+        return std::strcmp(group.name, name) == 0;
+      });
+
+  if (UNLIKELY(!ready_)) {
+    if (group == groups_.end()) {
+      groups_.push_back(
+          GroupRange{name, static_cast<int>(keys_.size()), -1, true});
+    } else {
+      // The same group is requested more than once.
+      group->isSkippable = false;
+    }
+    return;
+  }
+
+  if (rawProps.skippedGroupName_ != nullptr || group == groups_.end() ||
+      !group->isSkippable || group->end < 0) {
+    return;
+  }
+
+  for (auto keyIndex = group->begin; keyIndex < group->end; keyIndex++) {
+    if (rawProps.keyIndexToValueIndex_[keyIndex] != kRawPropsValueIndexEmpty) {
+      return;
+    }
+  }
+
+  rawProps.skippedGroupName_ = name;
+}
+
+void RawPropsParser::endGroup(RawProps const &rawProps, char const *name)
+    const noexcept {
+  if (UNLIKELY(!ready_)) {
+    for (auto &group : groups_) {
+      if (group.end == -1 && std::strcmp(group.name, name) == 0) {
+        group.end = static_cast<int>(keys_.size());
+      }
+    }
+    return;
+  }
+
+  if (rawProps.skippedGroupName_ != name) {
+    return;
+  }
+  rawProps.skippedGroupName_ = nullptr;
+
+  // Moving the cursor past the group, so the props requested after it are
+  // still found on the first try.
+  for (auto const &group : groups_) {
+    if (std::strcmp(group.name, name) == 0) {
+      rawProps.keyIndexCursor_ = group.end > 0
+          ? group.end - 1
+          : static_cast<int>(keys_.size()) - 1;
+      return;
+    }
+  }
+}
+
 void RawPropsParser::postPrepare() noexcept {
   ready_ = true;
   nameToIndex_.reindex();
@@ -124,8 +195,6 @@ void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
 
       for (size_t i = 0; i < count; i++) {
         auto nameValue = names.getValueAtIndex(runtime, i).getString(runtime);
-        auto value = object.getProperty(runtime, nameValue);
-
         auto name = nameValue.utf8(runtime);
 
         auto keyIndex = nameToIndex_.at(
@@ -135,9 +204,11 @@ void RawPropsParser::preparse(RawProps const &rawProps) const noexcept {
           continue;
         }
 
+        // Values are converted lazily, only when (and to what) the `Props`
+        // constructor asks for.
         rawProps.keyIndexToValueIndex_[keyIndex] = valueIndex;
         rawProps.values_.push_back(
-            RawValue(jsi::dynamicFromValue(runtime, value)));
+            RawValue(runtime, object.getProperty(runtime, nameValue)));
         valueIndex++;
       }
 
@@ -197,7 +268,7 @@ void RawPropsParser::iterateOverValues(
         auto name = nameValue.utf8(runtime);
 
         auto nameHash = RAW_PROPS_KEY_HASH(name.c_str());
-        auto rawValue = RawValue(jsi::dynamicFromValue(runtime, value));
+        auto rawValue = RawValue(runtime, std::move(value));
 
         visit(nameHash, name.c_str(), rawValue);
       }
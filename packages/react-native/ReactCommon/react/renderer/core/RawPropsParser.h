@@ -76,6 +76,12 @@ class RawPropsParser final {
   RawValue const *at(RawProps const &rawProps, RawPropsKey const &key)
       const noexcept;
 
+  /*
+   * To be used by `RawProps::Group` only.
+   */
+  void beginGroup(RawProps const &rawProps, char const *name) const noexcept;
+  void endGroup(RawProps const &rawProps, char const *name) const noexcept;
+
   /**
    * To be used by RawProps only. Value iterator functions.
    */
@@ -89,6 +95,19 @@ class RawPropsParser final {
       keys_{};
   mutable RawPropsKeyMap nameToIndex_{};
   mutable bool ready_{false};
+
+  /*
+   * A group of props occupies the `[begin, end)` range of `keys_`. A group
+   * which requests a prop registered before it can't be skipped.
+   */
+  struct GroupRange {
+    char const *name;
+    int begin;
+    int end;
+    bool isSkippable;
+  };
+
+  mutable butter::small_vector<GroupRange, 4> groups_{};
 };
 
 } // namespace react
@@ -27,11 +27,10 @@ class RawPropsParser;
  * `float`, `double`, `string`, and `vector` & `map` of those types and itself.
  *
  * The main intention of the class is to abstract React props parsing infra from
- * JSI, to enable support for any non-JSI-based data sources. The particular
- * implementation of the interface is a very slim abstraction around
- * `folly::dynamic` though.
- * In the near future, this class will hold a `jsi::Runtime` and `jsi::Value`
- * pair instead of `folly::dynamic`.
+ * JSI, to enable support for any non-JSI-based data sources. The class holds
+ * either a `jsi::Runtime` and `jsi::Value` pair, which is converted directly
+ * to the requested type only when it's casted (without an intermediate
+ * `folly::dynamic`), or a `folly::dynamic`.
  *
  * How `RawValue` is different from `JSI::Value`:
  *  * `RawValue` provides much more scoped API without any references to
@@ -56,11 +55,16 @@ class RawValue {
    */
   RawValue() noexcept : dynamic_(nullptr){};
 
-  RawValue(RawValue &&other) noexcept : dynamic_(std::move(other.dynamic_)) {}
+  RawValue(RawValue &&other) noexcept
+      : dynamic_(std::move(other.dynamic_)),
+        runtime_(other.runtime_),
+        value_(std::move(other.value_)) {}
 
   RawValue &operator=(RawValue &&other) noexcept {
     if (this != &other) {
       dynamic_ = std::move(other.dynamic_);
+      runtime_ = other.runtime_;
+      value_ = std::move(other.value_);
     }
     return *this;
   }
@@ -77,16 +81,27 @@ class RawValue {
 
   RawValue(folly::dynamic &&dynamic) noexcept : dynamic_(std::move(dynamic)){};
 
+  RawValue(jsi::Runtime &runtime, jsi::Value const &value) noexcept
+      : runtime_(&runtime), value_(runtime, value){};
+
+  RawValue(jsi::Runtime &runtime, jsi::Value &&value) noexcept
+      : runtime_(&runtime), value_(std::move(value)){};
+
   /*
    * Copy constructor and copy assignment operator would be private and only for
    * internal use, but it's needed for user-code that does `auto val =
    * (butter::map<std::string, RawValue>)rawVal;`
    */
-  RawValue(RawValue const &other) noexcept : dynamic_(other.dynamic_) {}
+  RawValue(RawValue const &other) noexcept
+      : dynamic_(other.dynamic_),
+        runtime_(other.runtime_),
+        value_(copyValue(other.runtime_, other.value_)) {}
 
   RawValue &operator=(const RawValue &other) noexcept {
     if (this != &other) {
       dynamic_ = other.dynamic_;
+      runtime_ = other.runtime_;
+      value_ = copyValue(other.runtime_, other.value_);
     }
     return *this;
   }
@@ -97,10 +112,16 @@ class RawValue {
    */
   template <typename T>
   explicit operator T() const {
+    if (runtime_ != nullptr) {
+      return castValue(*runtime_, value_, (T *)nullptr);
+    }
     return castValue(dynamic_, (T *)nullptr);
   }
 
   inline explicit operator folly::dynamic() const noexcept {
+    if (runtime_ != nullptr) {
+      return jsi::dynamicFromValue(*runtime_, value_);
+    }
     return dynamic_;
   }
 
@@ -109,6 +130,9 @@ class RawValue {
    */
   template <typename T>
   bool hasType() const noexcept {
+    if (runtime_ != nullptr) {
+      return checkValueType(*runtime_, value_, (T *)nullptr);
+    }
     return checkValueType(dynamic_, (T *)nullptr);
   };
 
@@ -116,12 +140,26 @@ class RawValue {
    * Checks if the stored value is *not* `null`.
    */
   bool hasValue() const noexcept {
+    if (runtime_ != nullptr) {
+      return !value_.isNull() && !value_.isUndefined();
+    }
     return !dynamic_.isNull();
   }
 
  private:
+  // Case 1: Source data is represented as `folly::dynamic`.
   folly::dynamic dynamic_;
 
+  // Case 2: Source data is represented as `jsi::Value` (if `runtime_` is set).
+  jsi::Runtime *runtime_{nullptr};
+  jsi::Value value_;
+
+  static jsi::Value copyValue(
+      jsi::Runtime *runtime,
+      jsi::Value const &value) noexcept {
+    return runtime != nullptr ? jsi::Value(*runtime, value) : jsi::Value();
+  }
+
   static bool checkValueType(
       const folly::dynamic &dynamic,
       RawValue *type) noexcept {
@@ -276,6 +314,232 @@ class RawValue {
     }
     return result;
   }
+
+  /*
+   * The `jsi::Value` counterparts of the functions above. They follow the
+   * semantic of converting the value to `folly::dynamic` first (with
+   * `jsi::dynamicFromValue`): `undefined` is treated as `null`, properties
+   * with `undefined` values are skipped and functions in objects become
+   * `null`. Values that can't be converted directly (e.g. a string which is
+   * casted to a number) go through `folly::dynamic` to get the exact same
+   * result.
+   */
+  static bool isArray(jsi::Runtime &runtime, jsi::Value const &value) {
+    return value.isObject() && value.getObject(runtime).isArray(runtime);
+  }
+
+  static bool isPlainObject(jsi::Runtime &runtime, jsi::Value const &value) {
+    if (!value.isObject()) {
+      return false;
+    }
+    auto object = value.getObject(runtime);
+    return !object.isArray(runtime) && !object.isFunction(runtime);
+  }
+
+  template <typename F>
+  static void iterateOverProperties(
+      jsi::Runtime &runtime,
+      jsi::Object const &object,
+      F const &visit) {
+    auto names = object.getPropertyNames(runtime);
+    auto count = names.size(runtime);
+    for (size_t i = 0; i < count; i++) {
+      auto name = names.getValueAtIndex(runtime, i).getString(runtime);
+      auto value = object.getProperty(runtime, name);
+      if (value.isUndefined()) {
+        continue;
+      }
+      if (value.isObject() && value.getObject(runtime).isFunction(runtime)) {
+        value = jsi::Value::null();
+      }
+      if (!visit(name, value)) {
+        break;
+      }
+    }
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      RawValue *type) noexcept {
+    return true;
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      bool *type) noexcept {
+    return value.isBool();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      int *type) noexcept {
+    return value.isNumber();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      int64_t *type) noexcept {
+    return value.isNumber();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      float *type) noexcept {
+    return value.isNumber();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      double *type) noexcept {
+    return value.isNumber();
+  }
+
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      std::string *type) noexcept {
+    return value.isString();
+  }
+
+  template <typename T>
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      std::vector<T> *type) noexcept {
+    if (!isArray(runtime, value)) {
+      return false;
+    }
+
+    // Note: We test only one element.
+    auto array = value.getObject(runtime).getArray(runtime);
+    if (array.size(runtime) == 0) {
+      return true;
+    }
+    return checkValueType(
+        runtime, array.getValueAtIndex(runtime, 0), (T *)nullptr);
+  }
+
+  template <typename T>
+  static bool checkValueType(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      butter::map<std::string, T> *type) noexcept {
+    if (!isPlainObject(runtime, value)) {
+      return false;
+    }
+
+    // Note: We test only one element.
+    auto result = true;
+    iterateOverProperties(
+        runtime,
+        value.getObject(runtime),
+        [&](jsi::String const & /*name*/, jsi::Value const &item) {
+          result = checkValueType(runtime, item, (T *)nullptr);
+          return false;
+        });
+    return result;
+  }
+
+  static RawValue castValue(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      RawValue *type) noexcept {
+    return RawValue(runtime, value);
+  }
+
+  static bool
+  castValue(jsi::Runtime &runtime, jsi::Value const &value, bool *type) {
+    if (value.isBool()) {
+      return value.getBool();
+    }
+    return castValue(jsi::dynamicFromValue(runtime, value), type);
+  }
+
+  static int
+  castValue(jsi::Runtime &runtime, jsi::Value const &value, int *type) {
+    if (value.isNumber()) {
+      return castValue(folly::dynamic(value.getNumber()), type);
+    }
+    return castValue(jsi::dynamicFromValue(runtime, value), type);
+  }
+
+  static int64_t
+  castValue(jsi::Runtime &runtime, jsi::Value const &value, int64_t *type) {
+    if (value.isNumber()) {
+      return castValue(folly::dynamic(value.getNumber()), type);
+    }
+    return castValue(jsi::dynamicFromValue(runtime, value), type);
+  }
+
+  static float
+  castValue(jsi::Runtime &runtime, jsi::Value const &value, float *type) {
+    if (value.isNumber()) {
+      return static_cast<float>(value.getNumber());
+    }
+    return castValue(jsi::dynamicFromValue(runtime, value), type);
+  }
+
+  static double
+  castValue(jsi::Runtime &runtime, jsi::Value const &value, double *type) {
+    if (value.isNumber()) {
+      return value.getNumber();
+    }
+    return castValue(jsi::dynamicFromValue(runtime, value), type);
+  }
+
+  static std::string castValue(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      std::string *type) {
+    if (value.isString()) {
+      return value.getString(runtime).utf8(runtime);
+    }
+    return castValue(jsi::dynamicFromValue(runtime, value), type);
+  }
+
+  template <typename T>
+  static std::vector<T> castValue(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      std::vector<T> *type) {
+    if (!isArray(runtime, value)) {
+      return castValue(jsi::dynamicFromValue(runtime, value), type);
+    }
+    auto array = value.getObject(runtime).getArray(runtime);
+    auto size = array.size(runtime);
+    auto result = std::vector<T>{};
+    result.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+      result.push_back(
+          castValue(runtime, array.getValueAtIndex(runtime, i), (T *)nullptr));
+    }
+    return result;
+  }
+
+  template <typename T>
+  static butter::map<std::string, T> castValue(
+      jsi::Runtime &runtime,
+      jsi::Value const &value,
+      butter::map<std::string, T> *type) {
+    if (!isPlainObject(runtime, value)) {
+      return castValue(jsi::dynamicFromValue(runtime, value), type);
+    }
+    auto result = butter::map<std::string, T>{};
+    iterateOverProperties(
+        runtime,
+        value.getObject(runtime),
+        [&](jsi::String const &name, jsi::Value const &item) {
+          result[name.utf8(runtime)] = castValue(runtime, item, (T *)nullptr);
+          return true;
+        });
+    return result;
+  }
 };
 
 } // namespace react
@@ -6,14 +6,16 @@
  */
 
 #include "ShadowNode.h"
-#include "DynamicPropsUtilities.h"
 #include "ShadowNodeFragment.h"
 
 #include <butter/small_vector.h>
+#include <folly/hash/Hash.h>
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/ComponentDescriptor.h>
+#include <react/renderer/core/LayoutableShadowNode.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
+#include <react/renderer/core/TraitCast.h>
 #include <react/renderer/debug/DebugStringConvertible.h>
 #include <react/renderer/debug/debugStringConvertibleUtils.h>
 
@@ -30,10 +32,10 @@ ShadowNode::SharedListOfShared ShadowNode::emptySharedShadowNodeSharedList() {
 /*
  * On iOS, this method returns `props` if provided, `sourceShadowNode`'s props
  * otherwise. On Android, we forward props in case `sourceShadowNode` hasn't
- * been mounted. `Props::rawProps` are merged from `props` to a copy of
- * `sourceShadowNode.props_` and returned. This is necessary to enable
- * Background Executor and should be removed once reimplementation of JNI layer
- * is finished.
+ * been mounted. `Props::rawProps` of `props` are merged on top of the ones of
+ * `sourceShadowNode.props_` (sharing, not copying them) and returned. This is
+ * necessary to enable Background Executor and should be removed once
+ * reimplementation of JNI layer is finished.
  */
 Props::Shared ShadowNode::propsForClonedShadowNode(
     ShadowNode const &sourceShadowNode,
@@ -43,8 +45,8 @@ Props::Shared ShadowNode::propsForClonedShadowNode(
   bool sourceNodeHasRawProps = !sourceShadowNode.getProps()->rawProps.empty();
   if (!hasBeenMounted && sourceNodeHasRawProps && props) {
     auto &castedProps = const_cast<Props &>(*props);
-    castedProps.rawProps = mergeDynamicProps(
-        sourceShadowNode.getProps()->rawProps, props->rawProps);
+    castedProps.rawProps =
+        sourceShadowNode.getProps()->rawProps.merged(props->rawProps);
     return props;
   }
 #endif
@@ -198,6 +200,46 @@ int ShadowNode::getOrderIndex() const {
   return orderIndex_;
 }
 
+uint64_t ShadowNode::getSubtreeHash() const {
+  auto hash = subtreeHash_.load(std::memory_order_relaxed);
+  if (hash != 0) {
+    return hash;
+  }
+
+  // `family_` identifies tag, surface id, component and event emitter.
+  hash = folly::hash::hash_128_to_64(
+      reinterpret_cast<uintptr_t>(family_.get()),
+      reinterpret_cast<uintptr_t>(props_.get()));
+  hash = folly::hash::hash_128_to_64(
+      hash, reinterpret_cast<uintptr_t>(state_.get()));
+  hash = folly::hash::hash_128_to_64(
+      hash,
+      (static_cast<uint64_t>(static_cast<uint32_t>(
+               traits_.get() & ViewAffectingTraits))
+           << 32) |
+          static_cast<uint32_t>(orderIndex_));
+
+  auto layoutableShadowNode = traitCast<LayoutableShadowNode const *>(this);
+  if (layoutableShadowNode != nullptr) {
+    hash = folly::hash::hash_128_to_64(
+        hash,
+        std::hash<LayoutMetrics>{}(layoutableShadowNode->getLayoutMetrics()));
+  }
+
+  for (auto const &child : *children_) {
+    hash = folly::hash::hash_128_to_64(hash, child->getSubtreeHash());
+  }
+
+  // Zero is reserved for "not computed yet".
+  if (hash == 0) {
+    hash = 1;
+  }
+
+  // Concurrent calls compute the same value, so a race here is benign.
+  subtreeHash_.store(hash, std::memory_order_relaxed);
+  return hash;
+}
+
 void ShadowNode::sealRecursive() const {
   if (getSealed()) {
     return;
@@ -66,6 +66,16 @@ class ShadowNode : public Sealable,
     return ShadowNodeTraits{};
   }
 
+  /*
+   * Traits which affect the views produced by a node, as opposed to traits
+   * which describe the state of its internal data (e.g. `ChildrenAreShared`
+   * or `DirtyYogaNode`). Only these are part of `getSubtreeHash()`.
+   */
+  static constexpr auto ViewAffectingTraits = ShadowNodeTraits::Trait(
+      ShadowNodeTraits::Trait::Hidden |
+      ShadowNodeTraits::Trait::FormsStackingContext |
+      ShadowNodeTraits::Trait::FormsView);
+
 #pragma mark - Constructors
 
   /*
@@ -157,6 +167,17 @@ class ShadowNode : public Sealable,
    */
   int getOrderIndex() const;
 
+  /*
+   * Returns a hash of the content of the whole subtree starting from the node:
+   * props, state, layout metrics, view-affecting traits and order index of
+   * every node in it. Nodes with different subtree hashes have different content; equal hashes
+   * are not a proof of equality (hashes can collide).
+   * The value is computed on the first call and cached; the method must only
+   * be called on nodes which are not going to be mutated anymore (e.g. nodes
+   * of a committed tree).
+   */
+  uint64_t getSubtreeHash() const;
+
   void sealRecursive() const;
 
   ShadowNodeFamily const &getFamily() const;
@@ -172,7 +193,6 @@ class ShadowNode : public Sealable,
   /*
    * Performs all side effects associated with mounting/unmounting in one place.
    * This is not `virtual` on purpose, do not override this.
-   * `EventEmitter::DispatchMutex()` must be acquired before calling.
    */
   void setMounted(bool mounted) const;
 
@@ -214,6 +234,11 @@ class ShadowNode : public Sealable,
 
   mutable std::atomic<bool> hasBeenMounted_{false};
 
+  /*
+   * Cached value of `getSubtreeHash()`; zero means "not computed yet".
+   */
+  mutable std::atomic<uint64_t> subtreeHash_{0};
+
   static Props::Shared propsForClonedShadowNode(
       ShadowNode const &sourceShadowNode,
       Props::Shared const &props);
@@ -9,6 +9,7 @@
 #include "ShadowNode.h"
 
 #include <react/debug/react_native_assert.h>
+#include <react/renderer/core/AncestorIndex.h>
 #include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/State.h>
 
@@ -57,7 +58,8 @@ const ComponentDescriptor &ShadowNodeFamily::getComponentDescriptor() const {
 }
 
 AncestorList ShadowNodeFamily::getAncestors(
-    ShadowNode const &ancestorShadowNode) const {
+    ShadowNode const &ancestorShadowNode,
+    AncestorIndex const *ancestorIndex) const {
   auto families = butter::small_vector<ShadowNodeFamily const *, 64>{};
   auto ancestorFamily = ancestorShadowNode.family_.get();
 
@@ -75,6 +77,19 @@ AncestorList ShadowNodeFamily::getAncestors(
   auto parentNode = &ancestorShadowNode;
   for (auto it = families.rbegin(); it != families.rend(); it++) {
     auto childFamily = *it;
+
+    if (ancestorIndex != nullptr) {
+      auto childIndex = ancestorIndex->getChildIndex(*parentNode, *childFamily);
+      if (childIndex == -1) {
+        ancestors.clear();
+        return ancestors;
+      }
+
+      ancestors.emplace_back(*parentNode, childIndex);
+      parentNode = parentNode->children_->at(childIndex).get();
+      continue;
+    }
+
     auto found = false;
     auto childIndex = 0;
     for (const auto &childNode : *parentNode->children_) {
@@ -19,6 +19,7 @@
 namespace facebook {
 namespace react {
 
+class AncestorIndex;
 class ComponentDescriptor;
 class ShadowNode;
 class State;
@@ -69,8 +70,12 @@ class ShadowNodeFamily final {
    * Returns an empty array if there is no ancestor-descendant relationship.
    * Can be called from any thread.
    * The theoretical complexity of the algorithm is `O(ln(n))`. Use it wisely.
+   * If `ancestorIndex` is provided, positions of nodes in children lists are
+   * looked up in (and memoized by) the index.
    */
-  AncestorList getAncestors(ShadowNode const &ancestorShadowNode) const;
+  AncestorList getAncestors(
+      ShadowNode const &ancestorShadowNode,
+      AncestorIndex const *ancestorIndex = nullptr) const;
 
   SurfaceId getSurfaceId() const;
 
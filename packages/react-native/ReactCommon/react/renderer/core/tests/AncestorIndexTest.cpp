@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/AncestorIndex.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+
+using namespace facebook::react;
+
+class AncestorIndexTest : public ::testing::Test {
+ protected:
+  AncestorIndexTest() {
+    auto eventDispatcher = EventDispatcher::Shared{};
+    componentDescriptorRegistry_ =
+        componentDescriptorProviderRegistry_.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    auto builder = ComponentBuilder{componentDescriptorRegistry_};
+
+    /*
+     * The structure:
+     * <A>
+     *  <AA0><AA0A/></AA0>
+     *  ...
+     *  <AA99><AA99A/></AA99>
+     * </A>
+     */
+    auto children = std::vector<ElementFragment>{};
+    for (int i = 0; i < kNumberOfChildren; i++) {
+      // clang-format off
+      children.push_back(
+        Element<ViewShadowNode>()
+          .tag(100 + i)
+          .children({
+            Element<ViewShadowNode>()
+              .tag(1000 + i)
+          }));
+      // clang-format on
+    }
+
+    rootShadowNode_ = builder.build(
+        Element<ViewShadowNode>().tag(1).children(std::move(children)));
+  }
+
+  static constexpr int kNumberOfChildren = 100;
+
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry_{};
+  ComponentDescriptorRegistry::Shared componentDescriptorRegistry_;
+  std::shared_ptr<ViewShadowNode> rootShadowNode_;
+};
+
+TEST_F(AncestorIndexTest, matchesLookupWithoutIndex) {
+  auto ancestorIndex = AncestorIndex{};
+
+  // Looking up every node twice: the first pass fills the index.
+  for (int pass = 0; pass < 2; pass++) {
+    for (auto const &childShadowNode : rootShadowNode_->getChildren()) {
+      auto const &grandchildShadowNode = childShadowNode->getChildren().at(0);
+      auto const &family = grandchildShadowNode->getFamily();
+
+      auto expected = family.getAncestors(*rootShadowNode_);
+      auto actual = family.getAncestors(*rootShadowNode_, &ancestorIndex);
+
+      ASSERT_EQ(actual.size(), 2);
+      ASSERT_EQ(actual.size(), expected.size());
+      for (size_t i = 0; i < actual.size(); i++) {
+        EXPECT_EQ(&actual[i].first.get(), &expected[i].first.get());
+        EXPECT_EQ(actual[i].second, expected[i].second);
+      }
+    }
+  }
+}
+
+TEST_F(AncestorIndexTest, validatesEntriesForDifferentTrees) {
+  auto ancestorIndex = AncestorIndex{};
+
+  auto const &lastChildShadowNode = rootShadowNode_->getChildren().back();
+  auto ancestors = lastChildShadowNode->getFamily().getAncestors(
+      *rootShadowNode_, &ancestorIndex);
+  ASSERT_EQ(ancestors.size(), 1);
+  EXPECT_EQ(ancestors[0].second, kNumberOfChildren - 1);
+
+  // A different revision of the tree where the last child is the first one.
+  auto children = rootShadowNode_->getChildren();
+  std::rotate(children.rbegin(), children.rbegin() + 1, children.rend());
+  auto newRootShadowNode = rootShadowNode_->clone(
+      {ShadowNodeFragment::propsPlaceholder(),
+       std::make_shared<ShadowNode::ListOfShared>(children)});
+
+  ancestors = lastChildShadowNode->getFamily().getAncestors(
+      *newRootShadowNode, &ancestorIndex);
+  ASSERT_EQ(ancestors.size(), 1);
+  EXPECT_EQ(&ancestors[0].first.get(), newRootShadowNode.get());
+  EXPECT_EQ(ancestors[0].second, 0);
+
+  // A node which is not in the tree.
+  auto newChildren = std::make_shared<ShadowNode::ListOfShared>(
+      ShadowNode::ListOfShared{children.begin() + 1, children.end()});
+  auto rootShadowNodeWithoutChild = rootShadowNode_->clone(
+      {ShadowNodeFragment::propsPlaceholder(), newChildren});
+  ancestors = lastChildShadowNode->getFamily().getAncestors(
+      *rootShadowNodeWithoutChild, &ancestorIndex);
+  EXPECT_EQ(ancestors.size(), 0);
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/DynamicPropsChain.h>
+#include <react/renderer/core/DynamicPropsUtilities.h>
+
+using namespace folly;
+using namespace facebook::react;
+
+TEST(DynamicPropsChainTest, handleEmptyAndNullChains) {
+  auto empty = DynamicPropsChain{};
+  EXPECT_TRUE(empty.empty());
+  EXPECT_FALSE(empty.isNull());
+  EXPECT_TRUE(empty.materialize().isObject());
+  EXPECT_TRUE(empty.materialize().empty());
+
+  auto null = DynamicPropsChain{dynamic()};
+  EXPECT_TRUE(null.empty());
+  EXPECT_TRUE(null.isNull());
+  EXPECT_TRUE(null.materialize().isNull());
+
+  auto props = DynamicPropsChain{dynamic::object("height", 100)};
+  EXPECT_FALSE(props.empty());
+  EXPECT_EQ(empty.merged(props).materialize(), props.materialize());
+  EXPECT_EQ(props.merged(empty).materialize(), props.materialize());
+}
+
+TEST(DynamicPropsChainTest, mergeLikeMergeDynamicProps) {
+  dynamic map1 = dynamic::object;
+  map1["style"] = dynamic::object("backgroundColor", "red");
+  map1["width"] = 50;
+
+  dynamic map2 = dynamic::object;
+  map2["style"] = dynamic::object("color", "black");
+  map2["height"] = 100;
+
+  dynamic map3 = dynamic::object;
+  map3["width"] = nullptr;
+
+  auto chain = DynamicPropsChain{map1}
+                   .merged(DynamicPropsChain{map2})
+                   .merged(DynamicPropsChain{map3});
+
+  EXPECT_EQ(
+      chain.materialize(),
+      mergeDynamicProps(mergeDynamicProps(map1, map2), map3));
+  EXPECT_TRUE(chain.materialize()["width"].isNull());
+}
+
+TEST(DynamicPropsChainTest, mergedChainsDoNotChangeSources) {
+  auto source = DynamicPropsChain{dynamic::object("opacity", 1)};
+  auto first = source.merged(DynamicPropsChain{dynamic::object("opacity", 2)});
+  auto second =
+      source.merged(DynamicPropsChain{dynamic::object("opacity", 3)});
+
+  EXPECT_EQ(source.materialize()["opacity"], 1);
+  EXPECT_EQ(first.materialize()["opacity"], 2);
+  EXPECT_EQ(second.materialize()["opacity"], 3);
+}
+
+TEST(DynamicPropsChainTest, overriddenPatchesAreDropped) {
+  auto chain = DynamicPropsChain{dynamic::object("width", 100)("opacity", 0)};
+  for (int i = 0; i < 10; i++) {
+    chain = chain.merged(DynamicPropsChain{dynamic::object("opacity", i)});
+    EXPECT_EQ(chain.getNumberOfPatches(), 2u);
+  }
+
+  chain = chain.merged(
+      DynamicPropsChain{dynamic::object("opacity", 1)("height", 50)});
+  EXPECT_EQ(chain.getNumberOfPatches(), 2u);
+  EXPECT_EQ(
+      chain.materialize(),
+      dynamic::object("width", 100)("opacity", 1)("height", 50));
+}
+
+TEST(DynamicPropsChainTest, longChainsAreSquashed) {
+  auto chain = DynamicPropsChain{};
+  for (int i = 0; i < 16; i++) {
+    chain = chain.merged(DynamicPropsChain{
+        dynamic::object("prop" + std::to_string(i % 10), i)});
+    EXPECT_EQ(chain.getNumberOfPatches(), static_cast<size_t>(i) + 1);
+  }
+
+  chain = chain.merged(DynamicPropsChain{dynamic::object("prop6", 16)});
+  EXPECT_EQ(chain.getNumberOfPatches(), 1u);
+
+  for (int i = 17; i < 100; i++) {
+    chain = chain.merged(DynamicPropsChain{
+        dynamic::object("prop" + std::to_string(i % 10), i)});
+    EXPECT_LE(chain.getNumberOfPatches(), 16u);
+  }
+
+  auto result = chain.materialize();
+  EXPECT_EQ(result.size(), 10);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(result["prop" + std::to_string(i)], 90 + i);
+  }
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/BatchedEventQueue.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventPipe.h>
+#include <react/renderer/core/StatePipe.h>
+
+#include <memory>
+#include <thread>
+
+namespace facebook::react {
+
+namespace {
+
+class TestEventBeat final : public EventBeat {
+ public:
+  using EventBeat::EventBeat;
+
+  void tick(jsi::Runtime &runtime) const {
+    beat(runtime);
+  }
+};
+
+} // namespace
+
+class EventQueueTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+
+    auto eventPipe = [this](
+                         jsi::Runtime &runtime,
+                         const EventTarget *eventTarget,
+                         const std::string &type,
+                         ReactEventPriority /*priority*/,
+                         const ValueFactory &payloadFactory) {
+      eventTargets_.push_back(eventTarget);
+      eventTypes_.push_back(type);
+      eventPayloads_.push_back(payloadFactory(runtime).getNumber());
+    };
+
+    auto dummyStatePipe = [](StateUpdate const &stateUpdate) {};
+
+    auto eventBeat = std::make_unique<TestEventBeat>(
+        std::make_shared<EventBeat::OwnerBox>());
+    eventBeat_ = eventBeat.get();
+
+    eventQueue_ = std::make_unique<BatchedEventQueue>(
+        EventQueueProcessor{eventPipe, dummyStatePipe}, std::move(eventBeat));
+
+    targetA_ =
+        std::make_shared<EventTarget>(*runtime_, jsi::Object(*runtime_), 1);
+    targetB_ =
+        std::make_shared<EventTarget>(*runtime_, jsi::Object(*runtime_), 2);
+  }
+
+  void TearDown() override {
+    eventQueue_.reset();
+    targetA_.reset();
+    targetB_.reset();
+  }
+
+  RawEvent makeEvent(
+      std::string type,
+      SharedEventTarget const &eventTarget,
+      double payload) {
+    return RawEvent(
+        std::move(type),
+        [payload](jsi::Runtime &) { return jsi::Value(payload); },
+        eventTarget,
+        RawEvent::Category::Unspecified);
+  }
+
+  void flush() {
+    eventBeat_->tick(*runtime_);
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  TestEventBeat *eventBeat_{};
+  std::unique_ptr<BatchedEventQueue> eventQueue_;
+  SharedEventTarget targetA_;
+  SharedEventTarget targetB_;
+  std::vector<EventTarget const *> eventTargets_;
+  std::vector<std::string> eventTypes_;
+  std::vector<double> eventPayloads_;
+};
+
+TEST_F(EventQueueTest, uniqueEventReplacesLastEventOfSameTargetAndType) {
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_, 1));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetB_, 2));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_, 3));
+  flush();
+
+  ASSERT_EQ(eventTypes_.size(), 2);
+  EXPECT_EQ(eventTargets_[0], targetA_.get());
+  EXPECT_EQ(eventPayloads_[0], 3);
+  EXPECT_EQ(eventTargets_[1], targetB_.get());
+  EXPECT_EQ(eventPayloads_[1], 2);
+}
+
+TEST_F(EventQueueTest, uniqueEventKeepsOrderOfDifferentTypes) {
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_, 1));
+  eventQueue_->enqueueEvent(makeEvent("scrollEnd", targetA_, 2));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_, 3));
+  flush();
+
+  ASSERT_EQ(eventTypes_.size(), 3);
+  EXPECT_EQ(eventTypes_[0], "scroll");
+  EXPECT_EQ(eventTypes_[1], "scrollEnd");
+  EXPECT_EQ(eventTypes_[2], "scroll");
+  EXPECT_EQ(eventPayloads_[2], 3);
+}
+
+TEST_F(EventQueueTest, uniqueEventReplacesRegularEvent) {
+  eventQueue_->enqueueEvent(makeEvent("scroll", targetA_, 1));
+  eventQueue_->enqueueEvent(makeEvent("scroll", targetA_, 2));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_, 3));
+  flush();
+
+  ASSERT_EQ(eventTypes_.size(), 2);
+  EXPECT_EQ(eventPayloads_[0], 1);
+  EXPECT_EQ(eventPayloads_[1], 3);
+}
+
+TEST_F(EventQueueTest, uniqueEventIsNotMergedWithFlushedEvent) {
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_, 1));
+  flush();
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", targetA_, 2));
+  flush();
+
+  ASSERT_EQ(eventTypes_.size(), 2);
+  EXPECT_EQ(eventPayloads_[0], 1);
+  EXPECT_EQ(eventPayloads_[1], 2);
+}
+
+TEST_F(EventQueueTest, concurrentProducers) {
+  constexpr int kNumberOfThreads = 4;
+  constexpr int kNumberOfEvents = 1000;
+
+  auto threads = std::vector<std::thread>{};
+  for (int i = 0; i < kNumberOfThreads; i++) {
+    threads.emplace_back([this, i] {
+      for (int j = 0; j < kNumberOfEvents; j++) {
+        eventQueue_->enqueueEvent(makeEvent("touchMove", nullptr, i));
+      }
+    });
+  }
+
+  // Flushing concurrently with producers.
+  for (int i = 0; i < 10; i++) {
+    flush();
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  eventBeat_->request();
+  flush();
+
+  EXPECT_EQ(eventTypes_.size(), kNumberOfThreads * kNumberOfEvents);
+}
+
+} // namespace facebook::react
@@ -5,7 +5,11 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <random>
+#include <vector>
+
 #include <gtest/gtest.h>
+#include <react/renderer/core/HitTestIndex.h>
 #include <react/renderer/element/Element.h>
 #include <react/renderer/element/testUtils.h>
 
@@ -225,3 +229,101 @@ TEST(FindNodeAtPointTest, overlappingViewsWithZIndex) {
   EXPECT_EQ(
             LayoutableShadowNode::findNodeAtPoint(parentShadowNode, {50, 50})->getTag(), 2);
 }
+
+static Element<ViewShadowNode> randomElement(
+    std::mt19937 &engine,
+    int &tag,
+    Size parentSize,
+    int depth) {
+  auto coordinate = [&](Float max) {
+    return Float(std::uniform_int_distribution<int>(-50, int(max))(engine));
+  };
+  auto dimension = [&]() {
+    return Float(std::uniform_int_distribution<int>(0, 300)(engine));
+  };
+
+  auto frame = Rect{
+      {coordinate(parentSize.width), coordinate(parentSize.height)},
+      {dimension(), dimension()}};
+  auto zIndex = std::uniform_int_distribution<int>(-1, 3)(engine);
+  auto transformKind = std::uniform_int_distribution<int>(0, 9)(engine);
+
+  auto element = Element<ViewShadowNode>();
+  element.tag(tag++)
+      .props([=] {
+        auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+        if (zIndex >= 0) {
+          sharedProps->zIndex = zIndex;
+          sharedProps->yogaStyle.positionType() = YGPositionTypeAbsolute;
+        }
+        if (transformKind == 0) {
+          sharedProps->transform = Transform::Scale(0.5, 0.5, 0);
+        } else if (transformKind == 1) {
+          sharedProps->transform = Transform::Translate(20, -20, 0);
+        }
+        return sharedProps;
+      })
+      .finalize([=](ViewShadowNode &shadowNode) {
+        auto layoutMetrics = EmptyLayoutMetrics;
+        layoutMetrics.frame = frame;
+        shadowNode.setLayoutMetrics(layoutMetrics);
+      });
+
+  if (depth > 0) {
+    // Wide lists make the index build grids.
+    auto maxNumberOfChildren = depth > 1 ? 40 : 6;
+    auto numberOfChildren =
+        std::uniform_int_distribution<int>(0, maxNumberOfChildren)(engine);
+    auto children = std::vector<ElementFragment>{};
+    for (int i = 0; i < numberOfChildren; i++) {
+      children.push_back(randomElement(engine, tag, frame.size, depth - 1));
+    }
+    element.children(std::move(children));
+  }
+
+  return element;
+}
+
+TEST(FindNodeAtPointTest, randomizedTreesWithHitTestIndex) {
+  auto builder = simpleComponentBuilder();
+
+  for (int seed = 0; seed < 20; seed++) {
+    auto engine = std::mt19937(seed);
+    auto tag = 1;
+
+    auto children = std::vector<ElementFragment>{};
+    for (int i = 0; i < 40; i++) {
+      children.push_back(randomElement(engine, tag, {1000, 1000}, 2));
+    }
+
+    // clang-format off
+    auto element =
+      Element<ViewShadowNode>()
+        .tag(tag++)
+        .finalize([](ViewShadowNode &shadowNode){
+          auto layoutMetrics = EmptyLayoutMetrics;
+          layoutMetrics.frame.size = {1200, 1200};
+          shadowNode.setLayoutMetrics(layoutMetrics);
+        })
+        .children(std::move(children));
+    // clang-format on
+
+    auto rootShadowNode = builder.build(element);
+
+    auto hitTestIndex = HitTestIndex{};
+    auto pointCoordinate = std::uniform_int_distribution<int>(-100, 1300);
+
+    for (int i = 0; i < 2000; i++) {
+      auto point = Point{
+          Float(pointCoordinate(engine)), Float(pointCoordinate(engine))};
+
+      auto expected =
+          LayoutableShadowNode::findNodeAtPoint(rootShadowNode, point);
+      auto actual = LayoutableShadowNode::findNodeAtPoint(
+          rootShadowNode, point, &hitTestIndex);
+
+      EXPECT_EQ(expected, actual)
+          << "seed: " << seed << ", point: " << point.x << ", " << point.y;
+    }
+  }
+}
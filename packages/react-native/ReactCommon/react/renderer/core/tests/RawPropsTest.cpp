@@ -6,8 +6,12 @@
  */
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
 #include <react/debug/flags.h>
 #include <react/renderer/core/ConcreteShadowNode.h>
 #include <react/renderer/core/PropsParserContext.h>
@@ -147,6 +151,93 @@ class PropsMultiLookup : public Props {
   const float derivedFloatValue{40};
 };
 
+class PropsNestedTypes : public Props {
+ public:
+  PropsNestedTypes() = default;
+  PropsNestedTypes(
+      const PropsParserContext & /*context*/,
+      const PropsNestedTypes & /*sourceProps*/,
+      const RawProps &rawProps) {
+    rawProps.at("arrayValue", nullptr, nullptr);
+    rawProps.at("objectValue", nullptr, nullptr);
+    rawProps.at("undefinedValue", nullptr, nullptr);
+  }
+};
+
+/*
+ * Requests `floatValue` and `stringValue` as a group, and optionally
+ * `intValue` once more from within the group.
+ */
+template <bool requestsIntValueInGroup>
+class PropsWithGroup : public Props {
+ public:
+  PropsWithGroup() = default;
+  PropsWithGroup(
+      const PropsParserContext &context,
+      const PropsWithGroup &sourceProps,
+      const RawProps &rawProps)
+      : intValue(convertRawProp(
+            context,
+            rawProps,
+            "intValue",
+            sourceProps.intValue,
+            17)) {
+    {
+      auto group = RawProps::Group{rawProps, "PropsWithGroup"};
+      floatValue = convertRawProp(
+          context, rawProps, "floatValue", sourceProps.floatValue, 56.75f);
+      if (requestsIntValueInGroup) {
+        intValueInGroup = convertRawProp(
+            context, rawProps, "intValue", sourceProps.intValueInGroup, 17);
+      }
+      stringValue = convertRawProp(
+          context, rawProps, "stringValue", sourceProps.stringValue, "");
+    }
+    boolValue = convertRawProp(
+        context, rawProps, "boolValue", sourceProps.boolValue, false);
+  }
+
+  int intValue{17};
+  int intValueInGroup{17};
+  float floatValue{56.75};
+  std::string stringValue{};
+  bool boolValue{false};
+};
+
+/*
+ * Requests a hundred props named `prop0`, `prop1`, ... `prop99`.
+ */
+class PropsManyKeys : public Props {
+ public:
+  static std::vector<std::string> const &names() {
+    static auto const names = [] {
+      auto names = std::vector<std::string>{};
+      for (int i = 0; i < 100; i++) {
+        names.push_back("prop" + std::to_string(i));
+      }
+      return names;
+    }();
+    return names;
+  }
+
+  PropsManyKeys() = default;
+  PropsManyKeys(
+      const PropsParserContext & /*context*/,
+      const PropsManyKeys & /*sourceProps*/,
+      const RawProps &rawProps) {
+    for (auto const &name : names()) {
+      rawProps.at(name.c_str(), nullptr, nullptr);
+    }
+  }
+};
+
+static facebook::jsi::Value evaluate(
+    facebook::jsi::Runtime &runtime,
+    std::string const &code) {
+  return runtime.evaluateJavaScript(
+      std::make_shared<facebook::jsi::StringBuffer>("(" + code + ")"), "");
+}
+
 TEST(RawPropsTest, handleProps) {
   ContextContainer contextContainer{};
   PropsParserContext parserContext{-1, contextContainer};
@@ -337,7 +428,6 @@ TEST(RawPropsTest, handleRawPropsPrimitiveTypesIncomplete) {
   EXPECT_EQ((int)*raw.at("intValue", nullptr, nullptr), 42);
 }
 
-#ifdef REACT_NATIVE_DEBUG
 TEST(RawPropsTest, handleRawPropsPrimitiveTypesIncorrectLookup) {
   ContextContainer contextContainer{};
   PropsParserContext parserContext{-1, contextContainer};
@@ -348,13 +438,98 @@ TEST(RawPropsTest, handleRawPropsPrimitiveTypesIncorrectLookup) {
   parser.prepare<PropsPrimitiveTypes>();
   raw.parse(parser, parserContext);
 
-  // Before D18662135, looking up an invalid key would trigger
-  // an infinite loop. This is out of contract, so we should only
-  // test this in debug.
+  // Looking up an invalid key is a hash map miss, which is safe in all
+  // build modes.
   EXPECT_EQ(raw.at("flurb", nullptr, nullptr), nullptr);
   EXPECT_EQ((int)*raw.at("intValue", nullptr, nullptr), 42);
 }
-#endif
+
+TEST(RawPropsTest, handleRawPropsManyKeysInAnyOrder) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  auto const &names = PropsManyKeys::names();
+  folly::dynamic object = folly::dynamic::object();
+  for (size_t i = 0; i < names.size(); i += 2) {
+    object[names[i]] = (int)i;
+  }
+  const auto &raw = RawProps(std::move(object));
+
+  auto parser = RawPropsParser();
+  parser.prepare<PropsManyKeys>();
+  raw.parse(parser, parserContext);
+
+  // Strided and reversed orders make every lookup miss the next-key guess.
+  for (size_t i = 0; i < names.size(); i++) {
+    auto index = (i * 37) % names.size();
+    auto value = raw.at(names[index].c_str(), nullptr, nullptr);
+    if (index % 2 == 0) {
+      ASSERT_NE(value, nullptr);
+      EXPECT_EQ((int)*value, (int)index);
+    } else {
+      EXPECT_EQ(value, nullptr);
+    }
+  }
+  for (auto i = names.size(); i > 0; i--) {
+    auto value = raw.at(names[i - 1].c_str(), nullptr, nullptr);
+    EXPECT_EQ(value != nullptr, i % 2 == 1);
+  }
+
+  EXPECT_EQ(raw.at("prop100", nullptr, nullptr), nullptr);
+  EXPECT_EQ(raw.at("prop", nullptr, nullptr), nullptr);
+  EXPECT_EQ((int)*raw.at("prop98", nullptr, nullptr), 98);
+}
+
+TEST(RawPropsTest, handleRawPropsGroups) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  auto parser = RawPropsParser();
+  parser.prepare<PropsWithGroup<false>>();
+
+  auto sourceProps = PropsWithGroup<false>{};
+  sourceProps.floatValue = 1.5;
+  sourceProps.stringValue = "source";
+
+  // None of the props of the group has a value: the group keeps the source
+  // values and the props requested after it are still found.
+  const auto &outsideRaw = RawProps(
+      folly::dynamic::object("intValue", (int)42)("boolValue", true));
+  outsideRaw.parse(parser, parserContext);
+  auto outsideProps =
+      PropsWithGroup<false>(parserContext, sourceProps, outsideRaw);
+  EXPECT_EQ(outsideProps.intValue, 42);
+  EXPECT_NEAR(outsideProps.floatValue, 1.5, 0.00001);
+  EXPECT_EQ(outsideProps.stringValue, "source");
+  EXPECT_TRUE(outsideProps.boolValue);
+
+  const auto &insideRaw = RawProps(
+      folly::dynamic::object("stringValue", "helloworld")("boolValue", true));
+  insideRaw.parse(parser, parserContext);
+  auto insideProps =
+      PropsWithGroup<false>(parserContext, sourceProps, insideRaw);
+  EXPECT_EQ(insideProps.intValue, 17);
+  EXPECT_NEAR(insideProps.floatValue, 1.5, 0.00001);
+  EXPECT_EQ(insideProps.stringValue, "helloworld");
+  EXPECT_TRUE(insideProps.boolValue);
+}
+
+TEST(RawPropsTest, handleRawPropsGroupsRequestingPreviousProps) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  auto parser = RawPropsParser();
+  parser.prepare<PropsWithGroup<true>>();
+
+  // `intValue` is registered before the group, so the group can't be skipped
+  // just because none of the props registered within it has a value.
+  const auto &raw = RawProps(folly::dynamic::object("intValue", (int)42));
+  raw.parse(parser, parserContext);
+  auto props = PropsWithGroup<true>(parserContext, {}, raw);
+  EXPECT_EQ(props.intValue, 42);
+  EXPECT_EQ(props.intValueInGroup, 42);
+  EXPECT_EQ(props.boolValue, false);
+}
 
 TEST(RawPropsTest, handlePropsMultiLookup) {
   ContextContainer contextContainer{};
@@ -374,3 +549,73 @@ TEST(RawPropsTest, handlePropsMultiLookup) {
   EXPECT_NEAR(props->floatValue, 10.0, 0.00001);
   EXPECT_NEAR(props->derivedFloatValue, 20.0, 0.00001);
 }
+
+TEST(RawPropsTest, handleJSIRawPropsPrimitiveTypes) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto runtime = facebook::hermes::makeHermesRuntime();
+
+  const auto &raw = RawProps(
+      *runtime,
+      evaluate(
+          *runtime,
+          R"({intValue: 42, doubleValue: 17.42, floatValue: 66.67, )"
+          R"(stringValue: "helloworld", boolValue: true, unknown: 1})"));
+
+  auto parser = RawPropsParser();
+  parser.prepare<PropsPrimitiveTypes>();
+  raw.parse(parser, parserContext);
+
+  EXPECT_EQ((int)*raw.at("intValue", nullptr, nullptr), 42);
+  EXPECT_NEAR((double)*raw.at("doubleValue", nullptr, nullptr), 17.42, 0.0001);
+  EXPECT_NEAR((float)*raw.at("floatValue", nullptr, nullptr), 66.67, 0.00001);
+  EXPECT_STREQ(
+      ((std::string)*raw.at("stringValue", nullptr, nullptr)).c_str(),
+      "helloworld");
+  EXPECT_EQ((bool)*raw.at("boolValue", nullptr, nullptr), true);
+
+  auto props = std::make_shared<PropsPrimitiveTypes>(
+      parserContext, PropsPrimitiveTypes(), raw);
+  EXPECT_FALSE(props->getSealed());
+}
+
+TEST(RawPropsTest, handleJSIRawPropsNestedTypes) {
+  using RawValueMap = facebook::butter::map<std::string, RawValue>;
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto runtime = facebook::hermes::makeHermesRuntime();
+
+  const auto &raw = RawProps(
+      *runtime,
+      evaluate(
+          *runtime,
+          R"({arrayValue: [1, 2.5, 3], undefinedValue: undefined, )"
+          R"(objectValue: {a: "12", b: undefined, c: () => {}, d: [true]}})"));
+
+  auto parser = RawPropsParser();
+  parser.prepare<PropsNestedTypes>();
+  raw.parse(parser, parserContext);
+
+  auto const &arrayValue = *raw.at("arrayValue", nullptr, nullptr);
+  EXPECT_TRUE(arrayValue.hasType<std::vector<float>>());
+  EXPECT_FALSE(arrayValue.hasType<std::vector<std::string>>());
+  EXPECT_FALSE((arrayValue.hasType<RawValueMap>()));
+  EXPECT_EQ((std::vector<float>)arrayValue, (std::vector<float>{1, 2.5, 3}));
+
+  EXPECT_FALSE(raw.at("undefinedValue", nullptr, nullptr)->hasValue());
+
+  auto const &objectValue = *raw.at("objectValue", nullptr, nullptr);
+  EXPECT_TRUE((objectValue.hasType<RawValueMap>()));
+  auto map = (RawValueMap)objectValue;
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.count("b"), 0);
+  // Values which can't be converted directly go through `folly::dynamic`.
+  EXPECT_EQ((int)map.at("a"), 12);
+  EXPECT_FALSE(map.at("c").hasValue());
+  EXPECT_EQ((std::vector<bool>)map.at("d"), (std::vector<bool>{true}));
+
+  EXPECT_EQ(
+      (folly::dynamic)objectValue,
+      folly::dynamic::object("a", "12")("c", nullptr)(
+          "d", folly::dynamic::array(true)));
+}
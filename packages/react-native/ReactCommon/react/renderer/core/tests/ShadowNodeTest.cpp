@@ -231,6 +231,37 @@ TEST_F(ShadowNodeTest, handleCloneFunction) {
   EXPECT_EQ(nodeAB_->getProps(), nodeABClone->getProps());
 }
 
+TEST_F(ShadowNodeTest, handleSubtreeHash) {
+  // Clones without any changes have the same content.
+  auto nodeABClone = nodeAB_->clone({});
+  EXPECT_EQ(nodeAB_->getSubtreeHash(), nodeABClone->getSubtreeHash());
+
+  // Nodes of different families never have the same content.
+  EXPECT_NE(nodeAA_->getSubtreeHash(), nodeAC_->getSubtreeHash());
+
+  // A change of props of a node changes hashes of the node and its ancestors.
+  auto nodeABBClone = nodeABB_->clone(
+      {/* .props = */ std::make_shared<const TestProps>()});
+  EXPECT_NE(nodeABB_->getSubtreeHash(), nodeABBClone->getSubtreeHash());
+
+  auto nodeABRevision2 = nodeAB_->clone({});
+  nodeABRevision2->replaceChild(*nodeABB_, nodeABBClone);
+  EXPECT_NE(nodeAB_->getSubtreeHash(), nodeABRevision2->getSubtreeHash());
+
+  // Replacing a child with its clone which has the same content does not.
+  auto nodeABRevision3 = nodeAB_->clone({});
+  nodeABRevision3->replaceChild(*nodeABA_, nodeABA_->clone({}));
+  EXPECT_EQ(nodeAB_->getSubtreeHash(), nodeABRevision3->getSubtreeHash());
+
+  // Order of children matters.
+  auto nodeABRevision4 = nodeAB_->clone(
+      {/* .props = */ ShadowNodeFragment::propsPlaceholder(),
+       /* .children = */
+       std::make_shared<ShadowNode::ListOfShared>(
+           ShadowNode::ListOfShared{nodeABB_, nodeABA_})});
+  EXPECT_NE(nodeAB_->getSubtreeHash(), nodeABRevision4->getSubtreeHash());
+}
+
 TEST_F(ShadowNodeTest, handleState) {
   auto family = std::make_shared<ShadowNodeFamily>(
       ShadowNodeFamilyFragment{
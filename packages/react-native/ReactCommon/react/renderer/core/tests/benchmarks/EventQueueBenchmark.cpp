@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/BatchedEventQueue.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/core/EventTarget.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+class BenchmarkEventBeat final : public EventBeat {
+ public:
+  using EventBeat::EventBeat;
+
+  void tick(jsi::Runtime &runtime) const {
+    beat(runtime);
+  }
+};
+
+/*
+ * Event queue which is constantly flushed on a separate thread (which plays
+ * the role of the JavaScript thread) and filled by a given number of
+ * additional producer threads, so the benchmarking thread measures the cost
+ * of enqueueing under contention.
+ */
+class ContendedEventQueue final {
+ public:
+  ContendedEventQueue(int numberOfTargets, int numberOfProducers) {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+
+    for (int i = 0; i < numberOfTargets; i++) {
+      eventTargets_.push_back(std::make_shared<EventTarget>(
+          *runtime_, jsi::Object(*runtime_), i));
+    }
+
+    auto eventPipe = [](jsi::Runtime & /*runtime*/,
+                        const EventTarget * /*eventTarget*/,
+                        const std::string & /*type*/,
+                        ReactEventPriority /*priority*/,
+                        const ValueFactory & /*payloadFactory*/) {};
+    auto statePipe = [](StateUpdate const & /*stateUpdate*/) {};
+
+    auto eventBeat = std::make_unique<BenchmarkEventBeat>(
+        std::make_shared<EventBeat::OwnerBox>());
+    auto eventBeatPointer = eventBeat.get();
+    eventQueue_ = std::make_unique<BatchedEventQueue>(
+        EventQueueProcessor{eventPipe, statePipe}, std::move(eventBeat));
+
+    threads_.emplace_back([this, eventBeatPointer] {
+      while (isRunning_.load(std::memory_order_relaxed)) {
+        eventBeatPointer->tick(*runtime_);
+      }
+    });
+
+    for (int i = 0; i < numberOfProducers; i++) {
+      threads_.emplace_back([this, i] {
+        auto index = size_t(i);
+        while (isRunning_.load(std::memory_order_relaxed)) {
+          enqueueScrollEvent(index++);
+        }
+      });
+    }
+  }
+
+  ~ContendedEventQueue() {
+    isRunning_ = false;
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+    eventQueue_.reset();
+    eventTargets_.clear();
+  }
+
+  void enqueueScrollEvent(size_t index) const {
+    eventQueue_->enqueueUniqueEvent(RawEvent(
+        "topScroll",
+        [](jsi::Runtime & /*runtime*/) { return jsi::Value::null(); },
+        eventTargets_[index % eventTargets_.size()],
+        RawEvent::Category::Continuous));
+  }
+
+ private:
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::vector<SharedEventTarget> eventTargets_;
+  std::unique_ptr<BatchedEventQueue> eventQueue_;
+  std::atomic<bool> isRunning_{true};
+  std::vector<std::thread> threads_;
+};
+
+} // namespace
+
+static void enqueueUniqueEventUnderConcurrentFlush(benchmark::State &state) {
+  auto eventQueue = ContendedEventQueue{
+      static_cast<int>(state.range(0)), static_cast<int>(state.range(1))};
+
+  size_t index = 0;
+  for (auto _ : state) {
+    eventQueue.enqueueScrollEvent(index++);
+  }
+}
+BENCHMARK(enqueueUniqueEventUnderConcurrentFlush)
+    ->ArgNames({"targets", "producers"})
+    ->Args({1, 0})
+    ->Args({64, 0})
+    ->Args({1, 3})
+    ->Args({64, 3})
+    ->UseRealTime();
+
+} // namespace facebook::react
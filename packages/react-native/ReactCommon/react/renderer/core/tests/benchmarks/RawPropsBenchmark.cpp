@@ -8,6 +8,8 @@
 #include <benchmark/benchmark.h>
 #include <folly/dynamic.h>
 #include <folly/json.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/RawProps.h>
@@ -31,6 +33,19 @@ auto propsStringWithSomeUnsupportedProps = std::string{
 auto unsupportedPropsDynamic =
     folly::parseJson(propsStringWithSomeUnsupportedProps);
 
+// A typical, fully styled view: flattened style (including nested objects and
+// arrays such as `shadowOffset` and `transform`) and a few other props.
+auto viewPropsString = std::string{
+    R"({"flex": 1, "flexDirection": "row", "alignItems": "center", "justifyContent": "space-between", "padding": 10, "marginHorizontal": 4, "width": "100%", "height": 48, "position": "relative", "backgroundColor": 4294967295, "borderRadius": 8, "borderWidth": 1, "borderColor": 4278190080, "opacity": 0.9, "shadowColor": 4278190080, "shadowOffset": {"width": 0, "height": 2}, "shadowOpacity": 0.2, "shadowRadius": 4, "transform": [{"translateX": 10}, {"scale": 1.5}, {"rotate": "45deg"}], "hitSlop": {"top": 8, "bottom": 8, "left": 8, "right": 8}, "accessibilityLabel": "Row", "accessibilityRole": "button", "nativeID": "row-1", "testID": "row", "pointerEvents": "box-none", "zIndex": 1})"};
+auto viewPropsDynamic = folly::parseJson(viewPropsString);
+auto opacityPropsDynamic = folly::parseJson(R"({"opacity": 0.5})");
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+auto propsValue = jsi::valueFromDynamic(*runtime, propsDynamic);
+auto unsupportedPropsValue =
+    jsi::valueFromDynamic(*runtime, unsupportedPropsDynamic);
+auto viewPropsValue = jsi::valueFromDynamic(*runtime, viewPropsDynamic);
+
 auto sourceProps = ViewProps{};
 auto sharedSourceProps = ViewShadowNode::defaultSharedProps();
 
@@ -82,6 +97,80 @@ static void propParsingRegularRawPropsWithNoSourceProps(
 }
 BENCHMARK(propParsingRegularRawPropsWithNoSourceProps);
 
+/*
+ * A high-frequency update (e.g. an animation) changing one prop of an already
+ * fully styled view: the groups of props it doesn't touch are skipped.
+ */
+static void propParsingSinglePropUpdate(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto styledProps = viewComponentDescriptor.cloneProps(
+      parserContext, nullptr, RawProps{viewPropsDynamic});
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, styledProps, RawProps{opacityPropsDynamic});
+  }
+}
+BENCHMARK(propParsingSinglePropUpdate);
+
+static void propParsingViewRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sharedSourceProps, RawProps{viewPropsDynamic});
+  }
+}
+BENCHMARK(propParsingViewRawProps);
+
+static void propParsingRegularJSIRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sharedSourceProps, RawProps{*runtime, propsValue});
+  }
+}
+BENCHMARK(propParsingRegularJSIRawProps);
+
+static void propParsingUnsupportedJSIRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext,
+        sharedSourceProps,
+        RawProps{*runtime, unsupportedPropsValue});
+  }
+}
+BENCHMARK(propParsingUnsupportedJSIRawProps);
+
+static void propParsingViewJSIRawProps(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sharedSourceProps, RawProps{*runtime, viewPropsValue});
+  }
+}
+BENCHMARK(propParsingViewJSIRawProps);
+
+/*
+ * Same as `propParsingViewJSIRawProps`, but converting the whole payload to
+ * `folly::dynamic` first, which is what parsing JSI props used to cost.
+ */
+static void propParsingViewJSIRawPropsThroughDynamic(benchmark::State &state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext,
+        sharedSourceProps,
+        RawProps{jsi::dynamicFromValue(*runtime, viewPropsValue)});
+  }
+}
+BENCHMARK(propParsingViewJSIRawPropsThroughDynamic);
+
 } // namespace facebook::react
 
 BENCHMARK_MAIN();
@@ -21,6 +21,7 @@ namespace facebook {
 namespace react {
 
 class JReadableMapBuffer;
+class MapBufferView;
 
 // clang-format off
 
@@ -143,10 +144,8 @@ class MapBuffer {
   // amount of items in the MapBuffer
   uint16_t count_ = 0;
 
-  // returns the relative offset of the first byte of dynamic data
-  int32_t getDynamicDataOffset() const;
-
-  int32_t getKeyBucket(MapBuffer::Key key) const;
+  // Accessors read the buffer through a view of it.
+  MapBufferView view() const;
 
   friend JReadableMapBuffer;
 };
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MapBufferView.h"
+
+#include <cstring>
+
+namespace facebook::react {
+
+static inline int32_t bucketOffset(int32_t index) {
+  return sizeof(MapBuffer::Header) + sizeof(MapBuffer::Bucket) * index;
+}
+
+static inline int32_t valueOffset(int32_t bucketIndex) {
+  return bucketOffset(bucketIndex) + offsetof(MapBuffer::Bucket, data);
+}
+
+MapBufferView::MapBufferView(MapBuffer const &buffer)
+    : MapBufferView(buffer.data(), buffer.size()) {}
+
+MapBufferView::MapBufferView(uint8_t const *data, size_t size)
+    : data_(data), size_(size) {
+  auto header = read<MapBuffer::Header>(0);
+  count_ = header.count;
+
+  if (header.bufferSize != size_) {
+    LOG(ERROR) << "Error: Data size does not match, expected "
+               << header.bufferSize << " found: " << size_;
+    abort();
+  }
+}
+
+template <typename T>
+T MapBufferView::read(size_t offset) const {
+  // Nested maps are not aligned within their parents, so values are copied
+  // out instead of being read in place.
+  T value;
+  memcpy(&value, data_ + offset, sizeof(T));
+  return value;
+}
+
+MapBufferView MapBufferView::withKeyIndex() const {
+  if (count_ == 0 || keyIndex_) {
+    return *this;
+  }
+
+  // Buckets are sorted by key.
+  auto minKey = read<Key>(bucketOffset(0));
+  auto maxKey = read<Key>(bucketOffset(count_ - 1));
+  uint32_t range = static_cast<uint32_t>(maxKey - minKey) + 1;
+  if (range > MAX_KEY_INDEX_RANGE) {
+    return *this;
+  }
+
+  auto keyIndex = std::make_shared<std::vector<uint16_t>>(range, NO_BUCKET);
+  for (uint16_t i = 0; i < count_; i++) {
+    (*keyIndex)[read<Key>(bucketOffset(i)) - minKey] = i;
+  }
+
+  auto view = *this;
+  view.minKey_ = minKey;
+  view.keyIndex_ = std::move(keyIndex);
+  return view;
+}
+
+bool MapBufferView::hasKeyIndex() const {
+  return keyIndex_ != nullptr;
+}
+
+int32_t MapBufferView::getKeyBucket(Key key) const {
+  if (keyIndex_) {
+    // Keys below `minKey_` wrap around to big indices.
+    uint32_t index = static_cast<uint32_t>(key - minKey_);
+    if (index >= keyIndex_->size()) {
+      return -1;
+    }
+    auto bucket = (*keyIndex_)[index];
+    return bucket == NO_BUCKET ? -1 : bucket;
+  }
+
+  int32_t lo = 0;
+  int32_t hi = count_ - 1;
+  while (lo <= hi) {
+    int32_t mid = (lo + hi) >> 1;
+
+    Key midVal = read<Key>(bucketOffset(mid));
+
+    if (midVal < key) {
+      lo = mid + 1;
+    } else if (midVal > key) {
+      hi = mid - 1;
+    } else {
+      return mid;
+    }
+  }
+
+  return -1;
+}
+
+bool MapBufferView::contains(Key key) const {
+  return getKeyBucket(key) != -1;
+}
+
+int32_t MapBufferView::getInt(Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return read<int32_t>(valueOffset(bucketIndex));
+}
+
+bool MapBufferView::getBool(Key key) const {
+  return getInt(key) != 0;
+}
+
+double MapBufferView::getDouble(Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return read<double>(valueOffset(bucketIndex));
+}
+
+int32_t MapBufferView::getDynamicDataOffset() const {
+  // The start of dynamic data can be calculated as the offset of the next
+  // key in the map
+  return bucketOffset(count_);
+}
+
+std::string MapBufferView::getString(Key key) const {
+  return std::string{getStringView(key)};
+}
+
+std::string_view MapBufferView::getStringView(Key key) const {
+  int32_t offset = getDynamicDataOffset() + getInt(key);
+  auto stringLength = read<int32_t>(offset);
+  auto stringPtr =
+      reinterpret_cast<char const *>(data_ + offset) + sizeof(int32_t);
+
+  return {stringPtr, static_cast<size_t>(stringLength)};
+}
+
+MapBufferView MapBufferView::getMapBuffer(Key key) const {
+  int32_t offset = getDynamicDataOffset() + getInt(key);
+  auto mapBufferLength = read<int32_t>(offset);
+
+  return MapBufferView(
+      data_ + offset + sizeof(int32_t), static_cast<size_t>(mapBufferLength));
+}
+
+std::vector<MapBufferView> MapBufferView::getMapBufferList(Key key) const {
+  std::vector<MapBufferView> mapBufferList;
+
+  int32_t offset = getDynamicDataOffset() + getInt(key);
+  auto mapBufferListLength = read<int32_t>(offset);
+  offset = offset + sizeof(int32_t);
+
+  int32_t curLen = 0;
+  while (curLen < mapBufferListLength) {
+    auto mapBufferLength = read<int32_t>(offset + curLen);
+    curLen = curLen + sizeof(int32_t);
+    mapBufferList.emplace_back(
+        data_ + offset + curLen, static_cast<size_t>(mapBufferLength));
+    curLen = curLen + mapBufferLength;
+  }
+  return mapBufferList;
+}
+
+MapBuffer MapBufferView::toMapBuffer() const {
+  return MapBuffer(std::vector<uint8_t>(data_, data_ + size_));
+}
+
+size_t MapBufferView::size() const {
+  return size_;
+}
+
+uint8_t const *MapBufferView::data() const {
+  return data_;
+}
+
+uint16_t MapBufferView::count() const {
+  return count_;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/mapbuffer/MapBuffer.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+/**
+ * MapBufferView is a non-owning, read-only view of serialized MapBuffer data
+ * (see `MapBuffer` for the format), e.g. of a map nested inside of another
+ * one. Nested maps and lists of maps are returned as views into the same
+ * bytes, so reading them does not copy anything; a view must not outlive the
+ * buffer it points to.
+ *
+ * Lookups binary-search the buckets. Views of maps whose keys span a small
+ * range can have a dense key index instead (see `withKeyIndex`), which maps a
+ * key to its bucket directly.
+ */
+class MapBufferView {
+ public:
+  using Key = MapBuffer::Key;
+
+  // The biggest key range (the difference between the biggest and the
+  // smallest keys plus one) a key index is built for.
+  constexpr static uint32_t MAX_KEY_INDEX_RANGE = 256;
+
+  explicit MapBufferView(MapBuffer const &buffer);
+
+  MapBufferView(uint8_t const *data, size_t size);
+
+  /**
+   * Returns a copy of the view with a key index, if the key range of the map
+   * is small enough. The index is shared between copies of the view.
+   */
+  MapBufferView withKeyIndex() const;
+
+  bool hasKeyIndex() const;
+
+  bool contains(Key key) const;
+
+  int32_t getInt(Key key) const;
+
+  bool getBool(Key key) const;
+
+  double getDouble(Key key) const;
+
+  std::string getString(Key key) const;
+
+  /**
+   * Returns the string without copying it; it points into the buffer.
+   */
+  std::string_view getStringView(Key key) const;
+
+  MapBufferView getMapBuffer(Key key) const;
+
+  std::vector<MapBufferView> getMapBufferList(Key key) const;
+
+  /**
+   * Copies the viewed bytes into a new, owning MapBuffer.
+   */
+  MapBuffer toMapBuffer() const;
+
+  size_t size() const;
+
+  uint8_t const *data() const;
+
+  uint16_t count() const;
+
+ private:
+  uint8_t const *data_{nullptr};
+
+  size_t size_{0};
+
+  uint16_t count_{0};
+
+  // The smallest key of the map and the bucket index for every key in
+  // `[minKey_, minKey_ + keyIndex_->size())` (`NO_BUCKET` for missing keys).
+  Key minKey_{0};
+  std::shared_ptr<std::vector<uint16_t> const> keyIndex_{};
+
+  constexpr static uint16_t NO_BUCKET = 0xFFFF;
+
+  template <typename T>
+  T read(size_t offset) const;
+
+  int32_t getDynamicDataOffset() const;
+
+  int32_t getKeyBucket(Key key) const;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
+
+using namespace facebook::react;
+
+static MapBuffer buildNestedMap() {
+  std::vector<MapBuffer> mapBufferList;
+  auto listBuilder = MapBufferBuilder();
+  listBuilder.putString(0, "First");
+  listBuilder.putInt(1, 1234);
+  mapBufferList.push_back(listBuilder.build());
+
+  auto listBuilder2 = MapBufferBuilder();
+  listBuilder2.putInt(2, 4321);
+  listBuilder2.putDouble(3, 908.1);
+  mapBufferList.push_back(listBuilder2.build());
+
+  auto innerBuilder = MapBufferBuilder();
+  innerBuilder.putString(0, "This is a test");
+  innerBuilder.putBool(1, true);
+  innerBuilder.putMapBufferList(2, mapBufferList);
+  auto inner = innerBuilder.build();
+
+  auto builder = MapBufferBuilder();
+  builder.putInt(0, 4321);
+  builder.putMapBuffer(1, inner);
+  builder.putDouble(7, 123.4);
+  return builder.build();
+}
+
+TEST(MapBufferViewTest, testPrimitiveEntries) {
+  auto map = buildNestedMap();
+  auto view = MapBufferView(map);
+
+  EXPECT_EQ(view.count(), 3);
+  EXPECT_EQ(view.size(), map.size());
+  EXPECT_EQ(view.data(), map.data());
+  EXPECT_EQ(view.getInt(0), 4321);
+  EXPECT_EQ(view.getDouble(7), 123.4);
+  EXPECT_TRUE(view.contains(7));
+  EXPECT_FALSE(view.contains(2));
+}
+
+TEST(MapBufferViewTest, testNestedEntriesAreNotCopied) {
+  auto map = buildNestedMap();
+  auto view = MapBufferView(map);
+
+  auto inner = view.getMapBuffer(1);
+  EXPECT_GT(inner.data(), map.data());
+  EXPECT_LE(inner.data() + inner.size(), map.data() + map.size());
+  EXPECT_EQ(inner.count(), 3);
+  EXPECT_EQ(inner.getString(0), "This is a test");
+  EXPECT_EQ(inner.getBool(1), true);
+
+  auto stringView = inner.getStringView(0);
+  EXPECT_EQ(stringView, "This is a test");
+  EXPECT_GT(reinterpret_cast<uint8_t const *>(stringView.data()), inner.data());
+
+  auto list = inner.getMapBufferList(2);
+  EXPECT_EQ(list.size(), 2);
+  EXPECT_EQ(list[0].getString(0), "First");
+  EXPECT_EQ(list[0].getInt(1), 1234);
+  EXPECT_EQ(list[1].getInt(2), 4321);
+  EXPECT_EQ(list[1].getDouble(3), 908.1);
+
+  // Views read the same bytes as the copying accessors of `MapBuffer`.
+  auto copy = map.getMapBuffer(1);
+  EXPECT_EQ(copy.size(), inner.size());
+  EXPECT_EQ(memcmp(copy.data(), inner.data(), copy.size()), 0);
+  EXPECT_EQ(inner.toMapBuffer().getString(0), "This is a test");
+}
+
+TEST(MapBufferViewTest, testKeyIndex) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(10, 1);
+  builder.putInt(12, 2);
+  builder.putString(200, "This is a test");
+  auto map = builder.build();
+
+  auto view = MapBufferView(map).withKeyIndex();
+  EXPECT_TRUE(view.hasKeyIndex());
+  EXPECT_EQ(view.getInt(10), 1);
+  EXPECT_EQ(view.getInt(12), 2);
+  EXPECT_EQ(view.getString(200), "This is a test");
+  EXPECT_FALSE(view.contains(0));
+  EXPECT_FALSE(view.contains(11));
+  EXPECT_FALSE(view.contains(201));
+  EXPECT_FALSE(view.contains(65535));
+}
+
+TEST(MapBufferViewTest, testKeyIndexIsSkippedForWideKeyRanges) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(0, 1);
+  builder.putInt(65535, 2);
+  auto map = builder.build();
+
+  auto view = MapBufferView(map).withKeyIndex();
+  EXPECT_FALSE(view.hasKeyIndex());
+  EXPECT_EQ(view.getInt(0), 1);
+  EXPECT_EQ(view.getInt(65535), 2);
+
+  auto empty = MapBufferBuilder::EMPTY();
+  EXPECT_FALSE(MapBufferView(empty).withKeyIndex().hasKeyIndex());
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
+
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr MapBuffer::Key kNumberOfKeys = 32;
+constexpr MapBuffer::Key kNumberOfFragments = 8;
+
+/*
+ * A map shaped like an attributed string: a few top-level values and a list
+ * of fragments, each of which has a nested map of text attributes.
+ */
+MapBuffer buildAttributedString() {
+  std::vector<MapBuffer> fragments;
+  for (int i = 0; i < kNumberOfFragments; i++) {
+    auto attributesBuilder = MapBufferBuilder();
+    for (MapBuffer::Key key = 0; key < kNumberOfKeys; key++) {
+      attributesBuilder.putDouble(key, key + i);
+    }
+
+    auto fragmentBuilder = MapBufferBuilder();
+    fragmentBuilder.putString(0, "Lorem ipsum dolor sit amet");
+    fragmentBuilder.putMapBuffer(5, attributesBuilder.build());
+    fragments.push_back(fragmentBuilder.build());
+  }
+
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "Lorem ipsum dolor sit amet");
+  builder.putMapBufferList(2, fragments);
+  return builder.build();
+}
+
+} // namespace
+
+static void mapBufferGetDouble(benchmark::State &state) {
+  auto attributesBuilder = MapBufferBuilder();
+  for (MapBuffer::Key key = 0; key < kNumberOfKeys; key++) {
+    attributesBuilder.putDouble(key, key);
+  }
+  auto map = attributesBuilder.build();
+
+  for (auto _ : state) {
+    double sum = 0;
+    for (MapBuffer::Key key = 0; key < kNumberOfKeys; key++) {
+      sum += map.getDouble(key);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(mapBufferGetDouble);
+
+static void mapBufferViewGetDouble(benchmark::State &state) {
+  auto attributesBuilder = MapBufferBuilder();
+  for (MapBuffer::Key key = 0; key < kNumberOfKeys; key++) {
+    attributesBuilder.putDouble(key, key);
+  }
+  auto map = attributesBuilder.build();
+  auto view = MapBufferView(map);
+  if (state.range(0) != 0) {
+    view = view.withKeyIndex();
+  }
+
+  for (auto _ : state) {
+    double sum = 0;
+    for (MapBuffer::Key key = 0; key < kNumberOfKeys; key++) {
+      sum += view.getDouble(key);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(mapBufferViewGetDouble)->ArgName("keyIndex")->Arg(0)->Arg(1);
+
+static void mapBufferReadNested(benchmark::State &state) {
+  auto map = buildAttributedString();
+
+  for (auto _ : state) {
+    double sum = 0;
+    for (auto const &fragment : map.getMapBufferList(2)) {
+      auto attributes = fragment.getMapBuffer(5);
+      sum += fragment.getString(0).size();
+      sum += attributes.getDouble(3) + attributes.getDouble(17);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(mapBufferReadNested);
+
+static void mapBufferViewReadNested(benchmark::State &state) {
+  auto map = buildAttributedString();
+  auto view = MapBufferView(map);
+
+  for (auto _ : state) {
+    double sum = 0;
+    for (auto const &fragment : view.getMapBufferList(2)) {
+      auto attributes = fragment.getMapBuffer(5);
+      sum += fragment.getStringView(0).size();
+      sum += attributes.getDouble(3) + attributes.getDouble(17);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(mapBufferViewReadNested);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
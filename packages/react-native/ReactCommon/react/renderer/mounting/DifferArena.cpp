@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DifferArena.h"
+
+#include <algorithm>
+#include <new>
+
+namespace facebook::react {
+
+struct alignas(std::max_align_t) DifferArena::Chunk final {
+  Chunk *previous;
+};
+
+struct DifferArena::FreeNode final {
+  FreeNode *next;
+};
+
+/*
+ * Returns the index of the smallest size class which fits `size` bytes, or
+ * `kNumberOfSizeClasses` if the size is bigger than any of the classes.
+ */
+static inline size_t sizeClassForSize(
+    size_t size,
+    size_t minSizeClassShift,
+    size_t numberOfSizeClasses) {
+  size_t sizeClass = 0;
+  while (sizeClass < numberOfSizeClasses &&
+         (size_t{1} << (sizeClass + minSizeClassShift)) < size) {
+    sizeClass++;
+  }
+  return sizeClass;
+}
+
+DifferArena::~DifferArena() {
+  while (lastChunk_ != nullptr) {
+    auto previous = lastChunk_->previous;
+    ::operator delete(lastChunk_);
+    lastChunk_ = previous;
+  }
+}
+
+void *DifferArena::allocate(size_t size) {
+  numberOfAllocations_++;
+
+  auto sizeClass =
+      sizeClassForSize(size, kMinSizeClassShift, kNumberOfSizeClasses);
+
+  if (sizeClass == kNumberOfSizeClasses) {
+    numberOfHeapAllocations_++;
+    return ::operator new(size);
+  }
+
+  auto &freeList = freeLists_[sizeClass];
+  if (freeList != nullptr) {
+    auto node = freeList;
+    freeList = node->next;
+    return node;
+  }
+
+  return allocateFromChunk(size_t{1} << (sizeClass + kMinSizeClassShift));
+}
+
+void DifferArena::deallocate(void *pointer, size_t size) noexcept {
+  auto sizeClass =
+      sizeClassForSize(size, kMinSizeClassShift, kNumberOfSizeClasses);
+
+  if (sizeClass == kNumberOfSizeClasses) {
+    ::operator delete(pointer);
+    return;
+  }
+
+  auto node = static_cast<FreeNode *>(pointer);
+  node->next = freeLists_[sizeClass];
+  freeLists_[sizeClass] = node;
+}
+
+void *DifferArena::allocateFromChunk(size_t size) {
+  if (static_cast<size_t>(end_ - cursor_) < size) {
+    auto chunkSize = std::max(nextChunkSize_, size);
+    nextChunkSize_ = std::min(nextChunkSize_ * 2, kMaxChunkSize);
+
+    auto chunk = static_cast<Chunk *>(::operator new(sizeof(Chunk) + chunkSize));
+    numberOfHeapAllocations_++;
+
+    chunk->previous = lastChunk_;
+    lastChunk_ = chunk;
+    cursor_ = reinterpret_cast<char *>(chunk + 1);
+    end_ = cursor_ + chunkSize;
+  }
+
+  auto pointer = cursor_;
+  cursor_ += size;
+  return pointer;
+}
+
+void DifferArena::incorporate(DifferArena const &other) noexcept {
+  numberOfAllocations_ += other.numberOfAllocations_;
+  numberOfHeapAllocations_ += other.numberOfHeapAllocations_;
+}
+
+int DifferArena::getNumberOfAllocations() const noexcept {
+  return numberOfAllocations_;
+}
+
+int DifferArena::getNumberOfHeapAllocations() const noexcept {
+  return numberOfHeapAllocations_;
+}
+
+} // namespace facebook::react
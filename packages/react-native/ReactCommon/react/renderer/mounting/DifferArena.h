@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Memory arena which backs all scratch data structures allocated during a
+ * single `calculateShadowViewMutations` call.
+ *
+ * Memory is carved out of large chunks; freed allocations are kept in
+ * per-size-class free lists and reused by following allocations of the same
+ * class. All chunks are released at once when the arena is destroyed.
+ * Allocations bigger than the biggest size class go directly to the heap.
+ *
+ * Not thread-safe: every thread participating in diffing must use its own
+ * arena.
+ */
+class DifferArena final {
+ public:
+  DifferArena() = default;
+  ~DifferArena();
+
+  /*
+   * Not copyable, not movable.
+   */
+  DifferArena(DifferArena const &other) = delete;
+  DifferArena &operator=(DifferArena const &other) = delete;
+
+  void *allocate(size_t size);
+  void deallocate(void *pointer, size_t size) noexcept;
+
+  /*
+   * Adds statistics of a different arena (e.g. one used on a different
+   * thread for a part of the same diff) to the statistics of this arena.
+   */
+  void incorporate(DifferArena const &other) noexcept;
+
+  /*
+   * Number of allocations requested from the arena.
+   */
+  int getNumberOfAllocations() const noexcept;
+
+  /*
+   * Number of allocations the arena itself requested from the heap.
+   */
+  int getNumberOfHeapAllocations() const noexcept;
+
+ private:
+  struct Chunk;
+  struct FreeNode;
+
+  static constexpr size_t kMinSizeClassShift = 4;
+  static constexpr size_t kNumberOfSizeClasses = 13;
+  static constexpr size_t kInitialChunkSize = 4 * 1024;
+  static constexpr size_t kMaxChunkSize = 64 * 1024;
+
+  void *allocateFromChunk(size_t size);
+
+  Chunk *lastChunk_{nullptr};
+  char *cursor_{nullptr};
+  char *end_{nullptr};
+  size_t nextChunkSize_{kInitialChunkSize};
+  std::array<FreeNode *, kNumberOfSizeClasses> freeLists_{};
+
+  int numberOfAllocations_{0};
+  int numberOfHeapAllocations_{0};
+};
+
+/*
+ * STL-compatible allocator which allocates from a `DifferArena`.
+ * A default-constructed allocator (without an arena) uses the heap.
+ */
+template <typename T>
+class DifferArenaAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  DifferArenaAllocator() noexcept = default;
+
+  DifferArenaAllocator(DifferArena *arena) noexcept : arena_(arena) {}
+
+  template <typename U>
+  DifferArenaAllocator(DifferArenaAllocator<U> const &other) noexcept
+      : arena_(other.arena_) {}
+
+  T *allocate(size_t count) {
+    auto size = count * sizeof(T);
+    if (arena_ == nullptr) {
+      return static_cast<T *>(::operator new(size));
+    }
+    return static_cast<T *>(arena_->allocate(size));
+  }
+
+  void deallocate(T *pointer, size_t count) noexcept {
+    if (arena_ == nullptr) {
+      ::operator delete(pointer);
+      return;
+    }
+    arena_->deallocate(pointer, count * sizeof(T));
+  }
+
+  DifferArena *getArena() const noexcept {
+    return arena_;
+  }
+
+  template <typename U>
+  bool operator==(DifferArenaAllocator<U> const &rhs) const noexcept {
+    return arena_ == rhs.arena_;
+  }
+
+  template <typename U>
+  bool operator!=(DifferArenaAllocator<U> const &rhs) const noexcept {
+    return arena_ != rhs.arena_;
+  }
+
+ private:
+  template <typename U>
+  friend class DifferArenaAllocator;
+
+  DifferArena *arena_{nullptr};
+};
+
+} // namespace react
+} // namespace facebook
@@ -10,9 +10,14 @@
 #include <butter/map.h>
 #include <butter/small_vector.h>
 #include <react/debug/react_native_assert.h>
+#include <react/renderer/core/CoreFeatures.h>
 #include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/core/TraitCast.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <algorithm>
+#include "DifferArena.h"
+#include "DiffingWorkerPool.h"
 #include "ShadowView.h"
 
 #ifdef DEBUG_LOGS_DIFFER
@@ -61,13 +66,30 @@ namespace facebook::react {
  * Besides that, we also need to optimize for insertion performance (the case
  * where a bunch of views appears on the screen first time); in this
  * implementation, this is as performant as vector `push_back`.
+ *
+ * Some lists (e.g. rows of a long list or cells of a grid) have hundreds or
+ * thousands of children though, and a linear lookup makes diffing of such
+ * reordered lists quadratic. Once the map grows past `kHashedLookupThreshold`
+ * elements, it maintains an additional open-addressing index of positions
+ * in the vector, which makes lookups constant. The vector stays the storage,
+ * so the iteration order is still the insertion order.
+ *
+ * The storage is allocated from the `DifferArena` of the current diff.
  */
-template <typename KeyT, typename ValueT, int DefaultSize = 16>
+template <typename KeyT, typename ValueT>
 class TinyMap final {
  public:
   using Pair = std::pair<KeyT, ValueT>;
   using Iterator = Pair *;
 
+  /*
+   * Maps with more elements than this use the hashed index for lookups.
+   */
+  static constexpr size_t kHashedLookupThreshold = 16;
+
+  explicit TinyMap(DifferArenaAllocator<Pair> allocator)
+      : vector_(allocator), index_(allocator) {}
+
   /**
    * This must strictly only be called from outside of this class.
    */
@@ -104,6 +126,10 @@ class TinyMap final {
       return end();
     }
 
+    if (!index_.empty()) {
+      return findInIndex(key);
+    }
+
     for (auto it = begin_() + erasedAtFront_; it != end(); it++) {
       if (it->first == key) {
         return it;
@@ -116,6 +142,16 @@ class TinyMap final {
   inline void insert(Pair pair) {
     react_native_assert(pair.first != 0);
     vector_.push_back(pair);
+
+    if (index_.empty()) {
+      if (vector_.size() > kHashedLookupThreshold) {
+        rebuildIndex();
+      }
+    } else if (vector_.size() * 2 > index_.size()) {
+      rebuildIndex();
+    } else {
+      insertIntoIndex(vector_.size() - 1);
+    }
   }
 
   inline void erase(Iterator iterator) {
@@ -165,11 +201,82 @@ class TinyMap final {
     }
     numErased_ = 0;
     erasedAtFront_ = 0;
+
+    // Positions of the elements have changed.
+    if (!index_.empty()) {
+      if (vector_.size() > kHashedLookupThreshold) {
+        rebuildIndex();
+      } else {
+        index_.clear();
+        indexShift_ = 0;
+      }
+    }
   }
 
-  butter::small_vector<Pair, DefaultSize> vector_;
+  /*
+   * Fibonacci hashing: the top bits of the product are well distributed even
+   * for sequential keys (which tags usually are).
+   */
+  inline size_t slotForKey(KeyT key) const {
+    return static_cast<size_t>(
+        (static_cast<uint32_t>(key) * uint32_t{2654435769u}) >> indexShift_);
+  }
+
+  /*
+   * Erased elements keep their slots in the index; their keys are `0`, so
+   * they never match and just act as tombstones until the next rebuild.
+   */
+  inline Iterator findInIndex(KeyT key) {
+    auto mask = index_.size() - 1;
+    for (auto slot = slotForKey(key);; slot = (slot + 1) & mask) {
+      auto position = index_[slot];
+      if (position == 0) {
+        return end();
+      }
+
+      auto &pair = vector_[position - 1];
+      if (pair.first == key) {
+        return &pair;
+      }
+    }
+  }
+
+  inline void insertIntoIndex(size_t position) {
+    auto mask = index_.size() - 1;
+    auto slot = slotForKey(vector_[position].first);
+    while (index_[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+    index_[slot] = static_cast<uint32_t>(position + 1);
+  }
+
+  /*
+   * Rebuilds the index with at least twice as many slots as there are
+   * elements in the vector, so the load factor never exceeds one half.
+   */
+  inline void rebuildIndex() {
+    size_t bits = 6;
+    while ((size_t{1} << bits) < vector_.size() * 2) {
+      bits++;
+    }
+
+    index_.assign(size_t{1} << bits, 0);
+    indexShift_ = 32 - bits;
+
+    for (size_t position = 0; position < vector_.size(); position++) {
+      if (vector_[position].first != 0) {
+        insertIntoIndex(position);
+      }
+    }
+  }
+
+  std::vector<Pair, DifferArenaAllocator<Pair>> vector_;
   size_t numErased_{0};
   size_t erasedAtFront_{0};
+
+  // Slots store positions in `vector_` plus one; `0` marks an empty slot.
+  std::vector<uint32_t, DifferArenaAllocator<uint32_t>> index_;
+  size_t indexShift_{0};
 };
 
 /*
@@ -263,7 +370,7 @@ ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
     ViewNodePairScope &scope,
     bool allowFlattened,
     Point layoutOffset) {
-  auto pairList = ShadowViewNodePair::NonOwningList{};
+  auto pairList = ShadowViewNodePair::NonOwningList{scope.get_allocator()};
 
   if (!shadowNode.getTraits().check(
           ShadowNodeTraits::Trait::FormsStackingContext) &&
@@ -334,24 +441,177 @@ static_assert(
     std::is_move_assignable<ShadowViewNodePair::NonOwningList>::value,
     "`ShadowViewNodePair::NonOwningList` must be `move assignable`.");
 
+/*
+ * A list of mutations which is only used during diffing and is allocated
+ * from the `DifferArena` of the current diff.
+ */
+using ScratchMutationList =
+    std::vector<ShadowViewMutation, DifferArenaAllocator<ShadowViewMutation>>;
+
 static void calculateShadowViewMutationsV2(
     ViewNodePairScope &scope,
-    ShadowViewMutation::List &mutations,
+    ScratchMutationList &mutations,
     ShadowView const &parentShadowView,
     ShadowViewNodePair::NonOwningList &&oldChildPairs,
     ShadowViewNodePair::NonOwningList &&newChildPairs,
     bool isRecursionRedundant = false);
 
 struct OrderedMutationInstructionContainer {
-  ShadowViewMutation::List createMutations{};
-  ShadowViewMutation::List deleteMutations{};
-  ShadowViewMutation::List insertMutations{};
-  ShadowViewMutation::List removeMutations{};
-  ShadowViewMutation::List updateMutations{};
-  ShadowViewMutation::List downwardMutations{};
-  ShadowViewMutation::List destructiveDownwardMutations{};
+  explicit OrderedMutationInstructionContainer(
+      DifferArenaAllocator<ShadowViewMutation> const &allocator)
+      : createMutations(allocator),
+        deleteMutations(allocator),
+        insertMutations(allocator),
+        removeMutations(allocator),
+        updateMutations(allocator),
+        downwardMutations(allocator),
+        destructiveDownwardMutations(allocator) {}
+
+  ScratchMutationList createMutations;
+  ScratchMutationList deleteMutations;
+  ScratchMutationList insertMutations;
+  ScratchMutationList removeMutations;
+  ScratchMutationList updateMutations;
+  ScratchMutationList downwardMutations;
+  ScratchMutationList destructiveDownwardMutations;
+};
+
+/*
+ * Returns `true` if two nodes (and, recursively, their children) describe
+ * the same views: same family, props, state, view-affecting traits, order
+ * index and layout metrics. Pointer-identical children are not walked.
+ */
+static bool subtreesHaveSameContent(
+    ShadowNode const &oldNode,
+    ShadowNode const &newNode) {
+  if (&oldNode.getFamily() != &newNode.getFamily() ||
+      oldNode.getProps() != newNode.getProps() ||
+      oldNode.getState() != newNode.getState() ||
+      (oldNode.getTraits().get() & ShadowNode::ViewAffectingTraits) !=
+          (newNode.getTraits().get() & ShadowNode::ViewAffectingTraits) ||
+      oldNode.getOrderIndex() != newNode.getOrderIndex()) {
+    return false;
+  }
+
+  auto oldLayoutableNode = traitCast<LayoutableShadowNode const *>(&oldNode);
+  auto newLayoutableNode = traitCast<LayoutableShadowNode const *>(&newNode);
+  if ((oldLayoutableNode == nullptr) != (newLayoutableNode == nullptr) ||
+      (oldLayoutableNode != nullptr &&
+       oldLayoutableNode->getLayoutMetrics() !=
+           newLayoutableNode->getLayoutMetrics())) {
+    return false;
+  }
+
+  auto const &oldChildren = oldNode.getChildren();
+  auto const &newChildren = newNode.getChildren();
+  if (oldChildren.size() != newChildren.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < oldChildren.size(); i++) {
+    if (oldChildren[i] != newChildren[i] &&
+        !subtreesHaveSameContent(*oldChildren[i], *newChildren[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*
+ * Returns `true` if children of two matched nodes need to be diffed.
+ * Pointer-identical nodes always have identical subtrees; different nodes
+ * can still have the same content (e.g. if they were cloned during layout
+ * which ended up producing the same layout metrics). Different subtree
+ * hashes prove that the content differs; equal hashes may be a collision,
+ * so in that case the content is compared (which is still much cheaper than
+ * diffing it).
+ */
+static inline bool subtreesMightDiffer(
+    ShadowViewNodePair const &oldPair,
+    ShadowViewNodePair const &newPair) {
+  if (oldPair.shadowNode == newPair.shadowNode) {
+    return false;
+  }
+
+  if (!CoreFeatures::enableSubtreeHashDiffing ||
+      oldPair.shadowNode->getSubtreeHash() !=
+          newPair.shadowNode->getSubtreeHash()) {
+    return true;
+  }
+
+  return !subtreesHaveSameContent(*oldPair.shadowNode, *newPair.shadowNode);
+}
+
+/*
+ * Describes diffing of children of a single matched (or entirely created or
+ * deleted) pair of nodes. Such a diff only reads the given pairs and their
+ * subtrees, so it can be computed on any thread; its mutations must then be
+ * appended to the `downwardMutations` (or `destructiveDownwardMutations` if
+ * there are no new children) list in the order the jobs were created.
+ */
+struct SubtreeDiffingJob {
+  ShadowViewNodePair const *oldPair{nullptr};
+  ShadowViewNodePair const *newPair{nullptr};
+  bool isRecursionRedundant{false};
+
+  // A job may run on a different thread, so it needs its own arena.
+  // The arena must outlive `mutations`.
+  std::unique_ptr<DifferArena> arena{};
+  ScratchMutationList mutations{};
+  bool isDestructive{false};
 };
 
+using SubtreeDiffingJobList = std::vector<SubtreeDiffingJob>;
+
+/*
+ * Returns `true` if subtree diffing jobs created on this thread should be
+ * collected and executed on `DiffingWorkerPool` instead of being computed
+ * in place. Jobs that are already executed by the pool are never split again.
+ */
+static bool shouldDiffSubtreesInParallel() {
+  return CoreFeatures::enableParallelDiffing &&
+      !DiffingWorkerPool::isExecutingJob();
+}
+
+static void runSubtreeDiffingJob(SubtreeDiffingJob &job);
+
+/*
+ * Executes collected jobs (concurrently, if possible) and appends their
+ * mutations to the container in the order of the jobs, so the result is
+ * identical to the one of the serial algorithm.
+ */
+static void flushSubtreeDiffingJobs(
+    SubtreeDiffingJobList &jobs,
+    OrderedMutationInstructionContainer &mutationContainer,
+    DifferArena *arena) {
+  if (jobs.empty()) {
+    return;
+  }
+
+  {
+    SystraceSection s("Differentiator::flushSubtreeDiffingJobs");
+    DiffingWorkerPool::shared().parallelFor(
+        jobs.size(), [&](size_t index) { runSubtreeDiffingJob(jobs[index]); });
+  }
+
+  for (auto &job : jobs) {
+    auto &mutations =
+        (job.isDestructive ? mutationContainer.destructiveDownwardMutations
+                           : mutationContainer.downwardMutations);
+    std::move(
+        job.mutations.begin(),
+        job.mutations.end(),
+        std::back_inserter(mutations));
+
+    if (arena != nullptr && job.arena != nullptr) {
+      arena->incorporate(*job.arena);
+    }
+  }
+
+  jobs.clear();
+}
+
 static void updateMatchedPairSubtrees(
     ViewNodePairScope &scope,
     OrderedMutationInstructionContainer &mutationContainer,
@@ -429,7 +689,8 @@ static void updateMatchedPairSubtrees(
     // Unflattening
     else {
       // Construct unvisited nodes map
-      auto unvisitedOldChildPairs = TinyMap<Tag, ShadowViewNodePair *>{};
+      auto unvisitedOldChildPairs =
+          TinyMap<Tag, ShadowViewNodePair *>{scope.get_allocator()};
       // We don't know where all the children of oldChildPair are
       // within oldChildPairs, but we know that they're in the same
       // relative order. The reason for this is because of flattening
@@ -479,10 +740,9 @@ static void updateMatchedPairSubtrees(
     return;
   }
 
-  // Update subtrees if View is not flattened, and if node addresses
-  // are not equal
-  if (oldPair.shadowNode != newPair.shadowNode) {
-    ViewNodePairScope innerScope{};
+  // Update subtrees if View is not flattened, and if subtrees are not equal
+  if (subtreesMightDiffer(oldPair, newPair)) {
+    ViewNodePairScope innerScope{scope.get_allocator()};
     auto oldGrandChildPairs =
         sliceChildShadowNodeViewPairsFromViewNodePair(oldPair, innerScope);
     auto newGrandChildPairs =
@@ -649,8 +909,10 @@ static void calculateShadowViewMutationsFlattener(
 
   // Views in other tree that are visited by sub-flattening or
   // sub-unflattening
-  TinyMap<Tag, ShadowViewNodePair *> subVisitedOtherNewNodes{};
-  TinyMap<Tag, ShadowViewNodePair *> subVisitedOtherOldNodes{};
+  TinyMap<Tag, ShadowViewNodePair *> subVisitedOtherNewNodes{
+      scope.get_allocator()};
+  TinyMap<Tag, ShadowViewNodePair *> subVisitedOtherOldNodes{
+      scope.get_allocator()};
   auto subVisitedNewMap =
       (parentSubVisitedOtherNewNodes != nullptr ? parentSubVisitedOtherNewNodes
                                                 : &subVisitedOtherNewNodes);
@@ -660,7 +922,7 @@ static void calculateShadowViewMutationsFlattener(
 
   // Candidates for full tree creation or deletion at the end of this function
   auto deletionCreationCandidatePairs =
-      TinyMap<Tag, ShadowViewNodePair const *>{};
+      TinyMap<Tag, ShadowViewNodePair const *>{scope.get_allocator()};
 
   for (size_t index = 0;
        index < treeChildren.size() && index < treeChildren.size();
@@ -824,8 +1086,8 @@ static void calculateShadowViewMutationsFlattener(
 
       // Update children if appropriate.
       if (!oldTreeNodePair.flattened && !newTreeNodePair.flattened) {
-        if (oldTreeNodePair.shadowNode != newTreeNodePair.shadowNode) {
-          ViewNodePairScope innerScope{};
+        if (subtreesMightDiffer(oldTreeNodePair, newTreeNodePair)) {
+          ViewNodePairScope innerScope{scope.get_allocator()};
           calculateShadowViewMutationsV2(
               innerScope,
               mutationContainer.downwardMutations,
@@ -865,7 +1127,7 @@ static void calculateShadowViewMutationsFlattener(
               true);
           // Construct unvisited nodes map
           auto unvisitedRecursiveChildPairs =
-              TinyMap<Tag, ShadowViewNodePair *>{};
+              TinyMap<Tag, ShadowViewNodePair *>{scope.get_allocator()};
           for (auto &flattenedNode : flattenedNodes) {
             auto &newChild = *flattenedNode;
 
@@ -1001,7 +1263,7 @@ static void calculateShadowViewMutationsFlattener(
           ShadowViewMutation::DeleteMutation(treeChildPair.shadowView));
 
       if (!treeChildPair.flattened) {
-        ViewNodePairScope innerScope{};
+        ViewNodePairScope innerScope{scope.get_allocator()};
         calculateShadowViewMutationsV2(
             innerScope,
             mutationContainer.destructiveDownwardMutations,
@@ -1015,7 +1277,7 @@ static void calculateShadowViewMutationsFlattener(
           ShadowViewMutation::CreateMutation(treeChildPair.shadowView));
 
       if (!treeChildPair.flattened) {
-        ViewNodePairScope innerScope{};
+        ViewNodePairScope innerScope{scope.get_allocator()};
         calculateShadowViewMutationsV2(
             innerScope,
             mutationContainer.downwardMutations,
@@ -1030,7 +1292,7 @@ static void calculateShadowViewMutationsFlattener(
 
 static void calculateShadowViewMutationsV2(
     ViewNodePairScope &scope,
-    ShadowViewMutation::List &mutations,
+    ScratchMutationList &mutations,
     ShadowView const &parentShadowView,
     ShadowViewNodePair::NonOwningList &&oldChildPairs,
     ShadowViewNodePair::NonOwningList &&newChildPairs,
@@ -1043,7 +1305,13 @@ static void calculateShadowViewMutationsV2(
   size_t index = 0;
 
   // Lists of mutations
-  auto mutationContainer = OrderedMutationInstructionContainer{};
+  auto mutationContainer =
+      OrderedMutationInstructionContainer{scope.get_allocator()};
+
+  // Independent subtrees which will be diffed on the worker pool, if enabled.
+  auto subtreeDiffingJobs = SubtreeDiffingJobList{};
+  auto deferredJobs =
+      shouldDiffSubtreesInParallel() ? &subtreeDiffingJobs : nullptr;
 
   DEBUG_LOGS({
     LOG(ERROR) << "Differ Entry: Child Pairs of node: [" << parentShadowView.tag
@@ -1115,10 +1383,15 @@ static void calculateShadowViewMutationsV2(
               parentShadowView));
     }
 
-    // Recursively update tree if ShadowNode pointers are not equal
+    // Recursively update tree if subtrees are not equal
     if (!oldChildPair.flattened &&
-        oldChildPair.shadowNode != newChildPair.shadowNode) {
-      ViewNodePairScope innerScope{};
+        subtreesMightDiffer(oldChildPair, newChildPair)) {
+      if (deferredJobs != nullptr) {
+        deferredJobs->push_back({&oldChildPair, &newChildPair});
+        continue;
+      }
+
+      ViewNodePairScope innerScope{scope.get_allocator()};
       auto oldGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
           oldChildPair, innerScope);
       auto newGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
@@ -1188,7 +1461,15 @@ static void calculateShadowViewMutationsV2(
 
       // We also have to call the algorithm recursively to clean up the entire
       // subtree starting from the removed view.
-      ViewNodePairScope innerScope{};
+      if (deferredJobs != nullptr) {
+        deferredJobs->push_back(
+            {&oldChildPair,
+             nullptr,
+             ShadowViewMutation::PlatformSupportsRemoveDeleteTreeInstruction});
+        continue;
+      }
+
+      ViewNodePairScope innerScope{scope.get_allocator()};
       calculateShadowViewMutationsV2(
           innerScope,
           mutationContainer.destructiveDownwardMutations,
@@ -1222,7 +1503,12 @@ static void calculateShadowViewMutationsV2(
       mutationContainer.createMutations.push_back(
           ShadowViewMutation::CreateMutation(newChildPair.shadowView));
 
-      ViewNodePairScope innerScope{};
+      if (deferredJobs != nullptr) {
+        deferredJobs->push_back({nullptr, &newChildPair});
+        continue;
+      }
+
+      ViewNodePairScope innerScope{scope.get_allocator()};
       calculateShadowViewMutationsV2(
           innerScope,
           mutationContainer.downwardMutations,
@@ -1232,10 +1518,18 @@ static void calculateShadowViewMutationsV2(
               newChildPair, innerScope));
     }
   } else {
+    // Subtrees matched during the first stage must be appended before any
+    // mutations produced by the reordering and (un)flattening below.
+    flushSubtreeDiffingJobs(
+        subtreeDiffingJobs, mutationContainer, scope.get_allocator().getArena());
+
     // Collect map of tags in the new list
-    auto newRemainingPairs = TinyMap<Tag, ShadowViewNodePair *>{};
-    auto newInsertedPairs = TinyMap<Tag, ShadowViewNodePair *>{};
-    auto deletionCandidatePairs = TinyMap<Tag, ShadowViewNodePair const *>{};
+    auto newRemainingPairs =
+        TinyMap<Tag, ShadowViewNodePair *>{scope.get_allocator()};
+    auto newInsertedPairs =
+        TinyMap<Tag, ShadowViewNodePair *>{scope.get_allocator()};
+    auto deletionCandidatePairs =
+        TinyMap<Tag, ShadowViewNodePair const *>{scope.get_allocator()};
     for (; index < newChildPairs.size(); index++) {
       auto &newChildPair = *newChildPairs[index];
       newRemainingPairs.insert({newChildPair.shadowView.tag, &newChildPair});
@@ -1459,7 +1753,12 @@ static void calculateShadowViewMutationsV2(
 
         // We also have to call the algorithm recursively to clean up the
         // entire subtree starting from the removed view.
-        ViewNodePairScope innerScope{};
+        if (deferredJobs != nullptr) {
+          deferredJobs->push_back({&oldChildPair, nullptr});
+          continue;
+        }
+
+        ViewNodePairScope innerScope{scope.get_allocator()};
         calculateShadowViewMutationsV2(
             innerScope,
             mutationContainer.destructiveDownwardMutations,
@@ -1503,7 +1802,12 @@ static void calculateShadowViewMutationsV2(
       mutationContainer.createMutations.push_back(
           ShadowViewMutation::CreateMutation(newChildPair.shadowView));
 
-      ViewNodePairScope innerScope{};
+      if (deferredJobs != nullptr) {
+        deferredJobs->push_back({nullptr, &newChildPair});
+        continue;
+      }
+
+      ViewNodePairScope innerScope{scope.get_allocator()};
       calculateShadowViewMutationsV2(
           innerScope,
           mutationContainer.downwardMutations,
@@ -1514,6 +1818,9 @@ static void calculateShadowViewMutationsV2(
     }
   }
 
+  flushSubtreeDiffingJobs(
+      subtreeDiffingJobs, mutationContainer, scope.get_allocator().getArena());
+
   // All mutations in an optimal order:
   std::move(
       mutationContainer.destructiveDownwardMutations.begin(),
@@ -1545,6 +1852,32 @@ static void calculateShadowViewMutationsV2(
       std::back_inserter(mutations));
 }
 
+static void runSubtreeDiffingJob(SubtreeDiffingJob &job) {
+  SystraceSection s("Differentiator::runSubtreeDiffingJob");
+
+  job.arena = std::make_unique<DifferArena>();
+  auto allocator = DifferArenaAllocator<ShadowViewNodePair>{job.arena.get()};
+  job.mutations = ScratchMutationList{allocator};
+
+  ViewNodePairScope innerScope{allocator};
+  auto oldGrandChildPairs = job.oldPair != nullptr
+      ? sliceChildShadowNodeViewPairsFromViewNodePair(*job.oldPair, innerScope)
+      : ShadowViewNodePair::NonOwningList{};
+  auto newGrandChildPairs = job.newPair != nullptr
+      ? sliceChildShadowNodeViewPairsFromViewNodePair(*job.newPair, innerScope)
+      : ShadowViewNodePair::NonOwningList{};
+
+  job.isDestructive = newGrandChildPairs.empty();
+
+  calculateShadowViewMutationsV2(
+      innerScope,
+      job.mutations,
+      (job.oldPair != nullptr ? job.oldPair : job.newPair)->shadowView,
+      std::move(oldGrandChildPairs),
+      std::move(newGrandChildPairs),
+      job.isRecursionRedundant);
+}
+
 /**
  * Only used by unit tests currently.
  */
@@ -1612,9 +1945,14 @@ ShadowViewMutation::List calculateShadowViewMutations(
   react_native_assert(
       ShadowNode::sameFamily(oldRootShadowNode, newRootShadowNode));
 
+  // All scratch data structures are allocated from the arena which is
+  // released at once at the end of the diff. Must outlive all of them.
+  DifferArena arena{};
+  auto allocator = DifferArenaAllocator<ShadowViewNodePair>{&arena};
+
   // See explanation of scope in Differentiator.h.
-  ViewNodePairScope viewNodePairScope{};
-  ViewNodePairScope innerViewNodePairScope{};
+  ViewNodePairScope viewNodePairScope{allocator};
+  ViewNodePairScope innerViewNodePairScope{allocator};
 
   auto mutations = ShadowViewMutation::List{};
   mutations.reserve(256);
@@ -1627,13 +1965,27 @@ ShadowViewMutation::List calculateShadowViewMutations(
         oldRootShadowView, newRootShadowView, {}));
   }
 
+  auto scratchMutations = ScratchMutationList{allocator};
+
   calculateShadowViewMutationsV2(
       innerViewNodePairScope,
-      mutations,
+      scratchMutations,
       ShadowView(oldRootShadowNode),
       sliceChildShadowNodeViewPairsV2(oldRootShadowNode, viewNodePairScope),
       sliceChildShadowNodeViewPairsV2(newRootShadowNode, viewNodePairScope));
 
+  mutations.reserve(mutations.size() + scratchMutations.size());
+  std::move(
+      scratchMutations.begin(),
+      scratchMutations.end(),
+      std::back_inserter(mutations));
+
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  if (telemetry != nullptr) {
+    telemetry->setNumberOfDiffAllocations(
+        arena.getNumberOfAllocations(), arena.getNumberOfHeapAllocations());
+  }
+
   return mutations;
 }
 
@@ -9,6 +9,7 @@
 
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/debug/flags.h>
+#include <react/renderer/mounting/DifferArena.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <deque>
 
@@ -37,8 +38,13 @@ enum class ReparentMode { Flatten, Unflatten };
  * both (1) ensures that pointers into the data-structure are never invalidated,
  * and (2) tries to efficiently allocate storage such that as many objects as
  * possible are close in memory, but does not guarantee adjacency.
+ *
+ * The allocator of the scope points to the `DifferArena` of the current diff;
+ * all other scratch data structures created for the scope (lists of pairs,
+ * maps, lists of mutations) share it.
  */
-using ViewNodePairScope = std::deque<ShadowViewNodePair>;
+using ViewNodePairScope =
+    std::deque<ShadowViewNodePair, DifferArenaAllocator<ShadowViewNodePair>>;
 
 /*
  * Calculates a list of view mutations which describes how the old
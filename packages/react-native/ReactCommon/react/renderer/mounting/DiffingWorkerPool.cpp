@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DiffingWorkerPool.h"
+
+#include <react/debug/react_native_assert.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace facebook::react {
+
+static thread_local bool isExecutingDiffingJob{false};
+
+/*
+ * A set of indices for a single `parallelFor` call.
+ * Indices are claimed by the calling thread and by workers one by one;
+ * the caller waits until every claimed index is finished.
+ */
+struct DiffingWorkerPool::Batch final {
+  Batch(Job const &job, size_t count) : job(job), count(count) {}
+
+  /*
+   * Executes jobs until there are no unclaimed indices left.
+   */
+  void execute() {
+    while (true) {
+      auto index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+      if (index >= count) {
+        return;
+      }
+
+      job(index);
+
+      if (pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.notify_all();
+      }
+    }
+  }
+
+  bool isExhausted() const {
+    return nextIndex.load(std::memory_order_relaxed) >= count;
+  }
+
+  // The job is owned by the caller of `parallelFor` which outlives
+  // all calls to it.
+  Job const &job;
+  size_t const count;
+  std::atomic<size_t> nextIndex{0};
+  std::atomic<size_t> pendingCount{count};
+  std::mutex mutex;
+  std::condition_variable finished;
+};
+
+DiffingWorkerPool &DiffingWorkerPool::shared() {
+  // Intentionally leaked: the worker threads are detached and live as long as
+  // the process does.
+  static auto &pool = *new DiffingWorkerPool(std::clamp<size_t>(
+      std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1, 1, 3));
+  return pool;
+}
+
+bool DiffingWorkerPool::isExecutingJob() noexcept {
+  return isExecutingDiffingJob;
+}
+
+DiffingWorkerPool::DiffingWorkerPool(size_t numberOfThreads)
+    : numberOfThreads_(numberOfThreads) {
+  for (size_t i = 0; i < numberOfThreads_; i++) {
+    std::thread([this] { runWorkerLoop(); }).detach();
+  }
+}
+
+void DiffingWorkerPool::runWorkerLoop() {
+  isExecutingDiffingJob = true;
+
+  while (true) {
+    auto batch = std::shared_ptr<Batch>{};
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return !batches_.empty(); });
+      batch = batches_.front();
+    }
+
+    batch->execute();
+
+    // The batch is exhausted; make sure nobody picks it up again.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!batches_.empty() && batches_.front() == batch) {
+      batches_.pop_front();
+    }
+  }
+}
+
+void DiffingWorkerPool::parallelFor(size_t count, Job const &job) {
+  if (count == 0) {
+    return;
+  }
+
+  if (count == 1 || isExecutingDiffingJob) {
+    for (size_t index = 0; index < count; index++) {
+      job(index);
+    }
+    return;
+  }
+
+  auto batch = std::make_shared<Batch>(job, count);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batches_.push_back(batch);
+  }
+  condition_.notify_all();
+
+  isExecutingDiffingJob = true;
+  batch->execute();
+  isExecutingDiffingJob = false;
+
+  {
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->finished.wait(lock, [&] {
+      return batch->pendingCount.load(std::memory_order_acquire) == 0;
+    });
+  }
+
+  react_native_assert(batch->isExhausted());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  batches_.erase(
+      std::remove(batches_.begin(), batches_.end(), batch), batches_.end());
+}
+
+} // namespace facebook::react
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace facebook {
+namespace react {
+
+/*
+ * A small process-wide pool of threads which is used by the Differentiator
+ * to diff independent sibling subtrees concurrently.
+ * The pool is created lazily on the first use and is never destroyed.
+ */
+class DiffingWorkerPool final {
+ public:
+  using Job = std::function<void(size_t index)>;
+
+  /*
+   * Returns the shared instance of the pool.
+   */
+  static DiffingWorkerPool &shared();
+
+  /*
+   * Returns `true` if the calling thread is currently executing a job
+   * scheduled via `parallelFor`. Nested `parallelFor` calls are executed
+   * serially on the calling thread.
+   */
+  static bool isExecutingJob() noexcept;
+
+  /*
+   * Calls `job` for every index in range `[0, count)` and returns when all
+   * the calls are finished. The order of the calls is not specified.
+   * The calling thread participates in executing the jobs, so the call never
+   * waits for a worker to become available.
+   */
+  void parallelFor(size_t count, Job const &job);
+
+ private:
+  struct Batch;
+
+  explicit DiffingWorkerPool(size_t numberOfThreads);
+
+  /*
+   * Not copyable.
+   */
+  DiffingWorkerPool(DiffingWorkerPool const &other) = delete;
+  DiffingWorkerPool &operator=(DiffingWorkerPool const &other) = delete;
+
+  void runWorkerLoop();
+
+  size_t const numberOfThreads_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::shared_ptr<Batch>> batches_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -13,12 +13,53 @@
 #endif
 
 #include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
 
 #include <react/debug/react_native_assert.h>
+#include <react/renderer/core/CoreFeatures.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 
 namespace facebook::react {
 
+/*
+ * Runs speculative diffing for all surfaces on a single background thread.
+ * The thread is created lazily and lives as long as the process does.
+ */
+static void dispatchSpeculativeDiffing(std::function<void()> &&task) {
+  struct Queue {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  // Intentionally leaked: the thread is detached and can outlive static
+  // objects.
+  static auto &queue = *[] {
+    auto queue = new Queue();
+    std::thread([queue] {
+      while (true) {
+        auto task = std::function<void()>{};
+        {
+          std::unique_lock<std::mutex> lock(queue->mutex);
+          queue->condition.wait(lock, [&] { return !queue->tasks.empty(); });
+          task = std::move(queue->tasks.front());
+          queue->tasks.pop_front();
+        }
+        task();
+      }
+    }).detach();
+    return queue;
+  }();
+
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+  }
+  queue.condition.notify_one();
+}
+
 MountingCoordinator::MountingCoordinator(const ShadowTreeRevision &baseRevision)
     : surfaceId_(baseRevision.rootShadowNode->getSurfaceId()),
       baseRevision_(baseRevision),
@@ -42,20 +83,109 @@ void MountingCoordinator::push(ShadowTreeRevision revision) const {
 
     if (!lastRevision_.has_value() || lastRevision_->number < revision.number) {
       lastRevision_ = std::move(revision);
+
+      if (CoreFeatures::enableSpeculativeDiffing && !isSpeculating_) {
+        isSpeculating_ = true;
+        // The background thread outlives any coordinator, so it must not
+        // access one which is already gone.
+        dispatchSpeculativeDiffing([weakThis = weak_from_this()] {
+          if (auto strongThis = weakThis.lock()) {
+            strongThis->speculate();
+          }
+        });
+      }
     }
   }
 
   signal_.notify_all();
 }
 
+void MountingCoordinator::speculate() const {
+  while (true) {
+    auto baseRootShadowNode = RootShadowNode::Shared{};
+    auto revision = ShadowTreeRevision{};
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      auto isUpToDate = speculativeTransaction_.has_value() &&
+          lastRevision_.has_value() &&
+          speculativeTransaction_->baseRootShadowNode ==
+              baseRevision_.rootShadowNode &&
+          speculativeTransaction_->revisionNumber == lastRevision_->number;
+
+      if (!baseRevision_.rootShadowNode || !lastRevision_.has_value() ||
+          isUpToDate) {
+        isSpeculating_ = false;
+        // Notifying under the lock: `revoke()` waits for this and the
+        // coordinator must not be accessed afterwards.
+        signal_.notify_all();
+        return;
+      }
+
+      baseRootShadowNode = baseRevision_.rootShadowNode;
+      revision = *lastRevision_;
+    }
+
+    auto telemetry = revision.telemetry;
+
+    telemetry.willDiff();
+    telemetry.setAsThreadLocal();
+
+    auto mutations = calculateShadowViewMutations(
+        *baseRootShadowNode, *revision.rootShadowNode);
+
+    telemetry.unsetAsThreadLocal();
+    telemetry.didDiff();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      // A newer revision might have arrived in the meantime, in which case
+      // the next iteration diffs the base revision against it instead. If the
+      // revision was pulled in the meantime, the base revision has changed
+      // and the result is discarded.
+      if (baseRevision_.rootShadowNode == baseRootShadowNode) {
+        speculativeTransaction_ = SpeculativeTransaction{
+            std::move(baseRootShadowNode),
+            revision.number,
+            std::move(mutations),
+            telemetry};
+      }
+    }
+
+    // All the shadow nodes and views retained by the iteration are released
+    // here, before `isSpeculating_` can be reset.
+  }
+}
+
+std::optional<MountingCoordinator::SpeculativeTransaction>
+MountingCoordinator::takeSpeculativeTransaction() const {
+  auto speculativeTransaction = std::move(speculativeTransaction_);
+  speculativeTransaction_.reset();
+
+  if (!speculativeTransaction.has_value() || !lastRevision_.has_value() ||
+      speculativeTransaction->baseRootShadowNode !=
+          baseRevision_.rootShadowNode ||
+      speculativeTransaction->revisionNumber != lastRevision_->number) {
+    return std::nullopt;
+  }
+
+  return speculativeTransaction;
+}
+
 void MountingCoordinator::revoke() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  std::unique_lock<std::mutex> lock(mutex_);
   // We have two goals here.
   // 1. We need to stop retaining `ShadowNode`s to not prolong their lifetime
   // to prevent them from overliving `ComponentDescriptor`s.
   // 2. A possible call to `pullTransaction()` should return empty optional.
   baseRevision_.rootShadowNode.reset();
   lastRevision_.reset();
+  speculativeTransaction_.reset();
+
+  // A speculative diff in progress still retains `ShadowNode`s.
+  signal_.wait(lock, [this]() { return !isSpeculating_; });
 }
 
 bool MountingCoordinator::waitForTransaction(
@@ -80,17 +210,34 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
 
   auto transaction = std::optional<MountingTransaction>{};
 
+  // A speculative diff which is still in progress is not waited for (the
+  // calling thread is usually the main one); it is discarded once it
+  // finishes, since the base revision changes below.
+  auto speculativeTransaction = takeSpeculativeTransaction();
+
+  // Speculative case
+  if (speculativeTransaction.has_value()) {
+    number_++;
+
+    transaction = MountingTransaction{
+        surfaceId_,
+        number_,
+        std::move(speculativeTransaction->mutations),
+        speculativeTransaction->telemetry};
+  }
   // Base case
-  if (lastRevision_.has_value()) {
+  else if (lastRevision_.has_value()) {
     number_++;
 
     auto telemetry = lastRevision_->telemetry;
 
     telemetry.willDiff();
+    telemetry.setAsThreadLocal();
 
     auto mutations = calculateShadowViewMutations(
         *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
 
+    telemetry.unsetAsThreadLocal();
     telemetry.didDiff();
 
     transaction = MountingTransaction{
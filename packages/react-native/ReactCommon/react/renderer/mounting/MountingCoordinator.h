@@ -8,6 +8,9 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <optional>
 
 #include <react/renderer/debug/flags.h>
@@ -32,7 +35,8 @@ namespace react {
  * object generates mutation instructions and returns it as a
  * `MountingTransaction`.
  */
-class MountingCoordinator final {
+class MountingCoordinator final
+    : public std::enable_shared_from_this<MountingCoordinator> {
  public:
   using Shared = std::shared_ptr<MountingCoordinator const>;
 
@@ -96,9 +100,36 @@ class MountingCoordinator final {
    * `MountingCoordinator` does not own (e.g. `ComponentDescriptor`s). Revoking
    * committed revisions allows the owner (a Shadow Tree) to make sure that
    * those resources will not be accessed (e.g. by the Mounting Layer).
+   * Waits for an in-progress speculative diff to finish.
    */
   void revoke() const;
 
+ private:
+  /*
+   * A list of mutations computed ahead of time on a background thread (see
+   * `CoreFeatures::enableSpeculativeDiffing`). Valid only as long as the base
+   * revision is still the one it was computed against.
+   */
+  struct SpeculativeTransaction {
+    RootShadowNode::Shared baseRootShadowNode;
+    ShadowTreeRevision::Number revisionNumber;
+    ShadowViewMutation::List mutations;
+    TransactionTelemetry telemetry;
+  };
+
+  /*
+   * Diffs the base revision against the last one on the calling (background)
+   * thread until the speculative transaction catches up with the last
+   * revision.
+   */
+  void speculate() const;
+
+  /*
+   * Returns the speculative transaction (if any) transforming the base
+   * revision into the last one. Must be called with `mutex_` locked.
+   */
+  std::optional<SpeculativeTransaction> takeSpeculativeTransaction() const;
+
  private:
   SurfaceId const surfaceId_;
 
@@ -110,6 +141,9 @@ class MountingCoordinator final {
   mutable std::weak_ptr<MountingOverrideDelegate const>
       mountingOverrideDelegate_;
 
+  mutable std::optional<SpeculativeTransaction> speculativeTransaction_{};
+  mutable bool isSpeculating_{false};
+
   TelemetryController telemetryController_;
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
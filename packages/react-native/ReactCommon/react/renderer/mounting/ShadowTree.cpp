@@ -10,6 +10,7 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/core/CoreFeatures.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutPrimitives.h>
 #include <react/renderer/debug/SystraceSection.h>
@@ -159,6 +160,111 @@ static ShadowNode::Unshared progressState(
   });
 }
 
+/*
+ * A node changed by a transaction paired with the node it replaced.
+ */
+using ShadowNodeEdit = std::pair<ShadowNode const *, ShadowNode const *>;
+
+/*
+ * Collects nodes of the new tree whose props or state differ from the ones of
+ * the corresponding nodes of the old tree. Nodes which were only cloned on the
+ * way to a changed descendant (or by layout) are not considered changed.
+ * Returns `false` if the structure of the trees differs (children were
+ * inserted, removed, or reordered); such changes are not rebased.
+ */
+static bool collectEdits(
+    ShadowNode const &newShadowNode,
+    ShadowNode const &oldShadowNode,
+    std::vector<ShadowNodeEdit> &edits) {
+  if (&newShadowNode == &oldShadowNode) {
+    return true;
+  }
+
+  if (newShadowNode.getProps() != oldShadowNode.getProps() ||
+      newShadowNode.getState() != oldShadowNode.getState()) {
+    edits.emplace_back(&newShadowNode, &oldShadowNode);
+  }
+
+  auto const &newChildren = newShadowNode.getChildren();
+  auto const &oldChildren = oldShadowNode.getChildren();
+
+  if (&newChildren == &oldChildren) {
+    return true;
+  }
+
+  if (newChildren.size() != oldChildren.size()) {
+    return false;
+  }
+
+  for (size_t index = 0; index < newChildren.size(); index++) {
+    if (!ShadowNode::sameFamily(*newChildren[index], *oldChildren[index]) ||
+        !collectEdits(*newChildren[index], *oldChildren[index], edits)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*
+ * Replays changes of props and state which a transaction made to
+ * `oldRootShadowNode` (resulting in `newRootShadowNode`) on top of
+ * `currentRootShadowNode`, a tree committed concurrently on top of
+ * `oldRootShadowNode`. Returns `nullptr` if the changes cannot be rebased,
+ * e.g. if both trees changed the same props of the same node.
+ */
+static RootShadowNode::Unshared rebaseRootShadowNode(
+    RootShadowNode const &oldRootShadowNode,
+    RootShadowNode const &newRootShadowNode,
+    RootShadowNode const &currentRootShadowNode) {
+  auto edits = std::vector<ShadowNodeEdit>{};
+  if (!collectEdits(newRootShadowNode, oldRootShadowNode, edits)) {
+    return nullptr;
+  }
+
+  auto rebasedRootShadowNode =
+      currentRootShadowNode.ShadowNode::clone(ShadowNodeFragment{});
+
+  for (auto const &[newShadowNode, oldShadowNode] : edits) {
+    if (newShadowNode == &newRootShadowNode) {
+      // Changes of the root node (e.g. layout constraints) are not rebased.
+      return nullptr;
+    }
+
+    auto arePropsChanged = newShadowNode->getProps() != oldShadowNode->getProps();
+    auto isStateChanged = newShadowNode->getState() != oldShadowNode->getState();
+    auto isConflicting = false;
+
+    rebasedRootShadowNode = rebasedRootShadowNode->cloneTree(
+        newShadowNode->getFamily(), [&](ShadowNode const &currentShadowNode) {
+          // The same change made by both transactions is not a conflict
+          // (e.g. the most recent state picked up by state reconciliation).
+          auto const &currentProps = currentShadowNode.getProps();
+          auto const &currentState = currentShadowNode.getState();
+          isConflicting = isConflicting ||
+              (arePropsChanged && currentProps != oldShadowNode->getProps() &&
+               currentProps != newShadowNode->getProps()) ||
+              (isStateChanged && currentState != oldShadowNode->getState() &&
+               currentState != newShadowNode->getState());
+
+          return currentShadowNode.clone({
+              arePropsChanged ? newShadowNode->getProps()
+                              : ShadowNodeFragment::propsPlaceholder(),
+              ShadowNodeFragment::childrenPlaceholder(),
+              isStateChanged ? newShadowNode->getState()
+                             : ShadowNodeFragment::statePlaceholder(),
+          });
+        });
+
+    if (!rebasedRootShadowNode || isConflicting) {
+      // The node was deleted or changed by the concurrent transaction.
+      return nullptr;
+    }
+  }
+
+  return std::static_pointer_cast<RootShadowNode>(rebasedRootShadowNode);
+}
+
 static void updateMountedFlag(
     const ShadowNode::ListOfShared &oldChildren,
     const ShadowNode::ListOfShared &newChildren) {
@@ -251,7 +357,11 @@ ShadowTree::ShadowTree(
           family));
 
   currentRevision_ = ShadowTreeRevision{
-      rootShadowNode, INITIAL_REVISION, TransactionTelemetry{}};
+      rootShadowNode,
+      INITIAL_REVISION,
+      TransactionTelemetry{},
+      std::make_shared<AncestorIndex const>(),
+      std::make_shared<HitTestIndex const>()};
 
   mountingCoordinator_ =
       std::make_shared<MountingCoordinator const>(currentRevision_);
@@ -304,7 +414,7 @@ CommitStatus ShadowTree::commit(
   while (true) {
     attempts++;
 
-    auto status = tryCommit(transaction, commitOptions);
+    auto status = tryCommit(transaction, commitOptions, attempts - 1);
     if (status != CommitStatus::Failed) {
       return status;
     }
@@ -318,10 +428,18 @@ CommitStatus ShadowTree::commit(
 CommitStatus ShadowTree::tryCommit(
     const ShadowTreeCommitTransaction &transaction,
     const CommitOptions &commitOptions) const {
+  return tryCommit(transaction, commitOptions, 0);
+}
+
+CommitStatus ShadowTree::tryCommit(
+    const ShadowTreeCommitTransaction &transaction,
+    const CommitOptions &commitOptions,
+    int numberOfRetries) const {
   SystraceSection s("ShadowTree::tryCommit");
 
   auto telemetry = TransactionTelemetry{};
   telemetry.willCommit();
+  telemetry.setNumberOfCommitRetries(numberOfRetries);
 
   CommitMode commitMode;
   auto oldRevision = ShadowTreeRevision{};
@@ -368,36 +486,87 @@ CommitStatus ShadowTree::tryCommit(
   // Seal the shadow node so it can no longer be mutated
   newRootShadowNode->sealRecursive();
 
-  {
-    // Updating `currentRevision_` in unique manner if it hasn't changed.
-    std::unique_lock lock(commitMutex_);
+  // Each rebase means that yet another transaction won the race, so a
+  // transaction which keeps losing it runs again from scratch instead.
+  constexpr int kMaxNumberOfRebases = 8;
+  int numberOfRebases = 0;
 
-    if (currentRevision_.number != oldRevision.number) {
-      return CommitStatus::Failed;
-    }
+  while (true) {
+    auto currentRevision = ShadowTreeRevision{};
 
-    auto newRevisionNumber = oldRevision.number + 1;
+    {
+      // Updating `currentRevision_` in unique manner if it hasn't changed.
+      std::unique_lock lock(commitMutex_);
 
-    if (!newRootShadowNode ||
-        (commitOptions.shouldYield && commitOptions.shouldYield())) {
-      return CommitStatus::Cancelled;
-    }
+      if (currentRevision_.number == oldRevision.number) {
+        auto newRevisionNumber = oldRevision.number + 1;
 
-    {
-      std::lock_guard<std::mutex> dispatchLock(EventEmitter::DispatchMutex());
+        if (!newRootShadowNode ||
+            (commitOptions.shouldYield && commitOptions.shouldYield())) {
+          return CommitStatus::Cancelled;
+        }
 
-      updateMountedFlag(
-          currentRevision_.rootShadowNode->getChildren(),
-          newRootShadowNode->getChildren());
+        // Mounted flags are published atomically, so updating them doesn't
+        // block event dispatching or commits of other surfaces.
+        updateMountedFlag(
+            currentRevision_.rootShadowNode->getChildren(),
+            newRootShadowNode->getChildren());
+
+        telemetry.didCommit();
+        telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
+
+        newRevision = ShadowTreeRevision{
+            std::move(newRootShadowNode),
+            newRevisionNumber,
+            telemetry,
+            std::make_shared<AncestorIndex const>(),
+            std::make_shared<HitTestIndex const>()};
+
+        currentRevision_ = newRevision;
+        break;
+      }
+
+      if (!CoreFeatures::enableCommitRebasing || !newRootShadowNode ||
+          numberOfRebases == kMaxNumberOfRebases) {
+        return CommitStatus::Failed;
+      }
+
+      currentRevision = currentRevision_;
     }
 
-    telemetry.didCommit();
-    telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
+    // Another transaction was committed in the meantime. Instead of running
+    // the whole transaction again, its changes are replayed on top of the new
+    // tree, which then only needs to be laid out incrementally.
+    auto rebasedRootShadowNode = rebaseRootShadowNode(
+        *oldRevision.rootShadowNode,
+        *newRootShadowNode,
+        *currentRevision.rootShadowNode);
+    if (!rebasedRootShadowNode) {
+      return CommitStatus::Failed;
+    }
+
+    numberOfRebases++;
+    telemetry.didRebaseCommit();
+
+    rebasedRootShadowNode = delegate_.shadowTreeWillCommit(
+        *this, currentRevision.rootShadowNode, rebasedRootShadowNode);
 
-    newRevision = ShadowTreeRevision{
-        std::move(newRootShadowNode), newRevisionNumber, telemetry};
+    if (rebasedRootShadowNode) {
+      // None of the nodes laid out for the original tree are part of the
+      // rebased one (it consists of nodes of the current tree and their
+      // clones), so layout events are emitted for the rebased tree only.
+      // Nodes changed by the concurrent transaction got theirs from it.
+      affectedLayoutableNodes.clear();
+
+      telemetry.setAsThreadLocal();
+      rebasedRootShadowNode->layoutIfNeeded(&affectedLayoutableNodes);
+      telemetry.unsetAsThreadLocal();
+
+      rebasedRootShadowNode->sealRecursive();
+    }
 
-    currentRevision_ = newRevision;
+    oldRevision = std::move(currentRevision);
+    newRootShadowNode = std::move(rebasedRootShadowNode);
   }
 
   emitLayoutEvents(affectedLayoutableNodes);
@@ -106,6 +106,9 @@ class ShadowTree final {
 
   /*
    * Calls `tryCommit` in a loop until it finishes successfully.
+   * If `CoreFeatures::enableCommitRebasing` is on, a commit which raced with
+   * another one replays its changes on top of the newer tree instead of
+   * calling `transaction` again whenever the changes don't conflict.
    */
   CommitStatus commit(
       const ShadowTreeCommitTransaction &transaction,
@@ -134,6 +137,11 @@ class ShadowTree final {
  private:
   constexpr static ShadowTreeRevision::Number INITIAL_REVISION{0};
 
+  CommitStatus tryCommit(
+      const ShadowTreeCommitTransaction &transaction,
+      const CommitOptions &commitOptions,
+      int numberOfRetries) const;
+
   void mount(ShadowTreeRevision revision, bool mountSynchronously) const;
 
   void emitLayoutEvents(
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/core/AncestorIndex.h>
+#include <react/renderer/core/HitTestIndex.h>
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
 #include <react/renderer/mounting/MountingTransaction.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
@@ -18,7 +20,8 @@ namespace react {
 
 /*
  * Represent a particular committed state of a shadow tree. The object contains
- * a pointer to a root shadow node, a sequential number of commit and telemetry.
+ * a pointer to a root shadow node, a sequential number of commit, telemetry
+ * and indices that speed up ancestor lookups and hit-testing in the tree.
  */
 class ShadowTreeRevision final {
  public:
@@ -34,6 +37,13 @@ class ShadowTreeRevision final {
   RootShadowNode::Shared rootShadowNode;
   Number number;
   TransactionTelemetry telemetry;
+
+  /*
+   * Filled lazily by lookups (e.g. by measure calls and hit-testing); shared
+   * among all copies of the revision.
+   */
+  std::shared_ptr<AncestorIndex const> ancestorIndex;
+  std::shared_ptr<HitTestIndex const> hitTestIndex;
 };
 
 } // namespace react
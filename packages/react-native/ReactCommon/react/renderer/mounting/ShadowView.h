@@ -15,6 +15,9 @@
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/debug/flags.h>
+#include <react/renderer/mounting/DifferArena.h>
+
+#include <vector>
 
 namespace facebook {
 namespace react {
@@ -65,8 +68,8 @@ std::vector<DebugStringConvertibleObject> getDebugProps(
  *
  */
 struct ShadowViewNodePair final {
-  using NonOwningList = butter::
-      small_vector<ShadowViewNodePair *, kShadowNodeChildrenSmallVectorSize>;
+  using NonOwningList = std::
+      vector<ShadowViewNodePair *, DifferArenaAllocator<ShadowViewNodePair *>>;
   using OwningList = butter::
       small_vector<ShadowViewNodePair, kShadowNodeChildrenSmallVectorSize>;
 
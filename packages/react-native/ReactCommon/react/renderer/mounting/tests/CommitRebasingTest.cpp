@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <functional>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/CoreFeatures.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+
+#include <react/renderer/element/testUtils.h>
+
+namespace facebook::react {
+
+class CommitRebasingShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      ShadowTree const & /*shadowTree*/,
+      RootShadowNode::Shared const & /*oldRootShadowNode*/,
+      RootShadowNode::Unshared const &newRootShadowNode) const override {
+    // Commits made by the hook itself don't call it again.
+    if (willCommitHook && !isRunningWillCommitHook_) {
+      isRunningWillCommitHook_ = true;
+      willCommitHook();
+      isRunningWillCommitHook_ = false;
+    }
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override{};
+
+  /*
+   * Called on every run of commit hooks (including the ones of rebased
+   * trees), e.g. to make another commit win the race.
+   */
+  std::function<void()> willCommitHook;
+
+ private:
+  mutable bool isRunningWillCommitHook_{false};
+};
+
+class CommitRebasingTest : public ::testing::Test {
+ protected:
+  CommitRebasingTest() : builder_(simpleComponentBuilder()) {
+    CoreFeatures::enableCommitRebasing = true;
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .children({
+            Element<ViewShadowNode>()
+              .reference(shadowNodeA_),
+            Element<ViewShadowNode>()
+              .reference(shadowNodeB_)
+          });
+    // clang-format on
+
+    builder_.build(element);
+
+    shadowTree_ = std::make_unique<ShadowTree>(
+        SurfaceId{11},
+        LayoutConstraints{},
+        LayoutContext{},
+        shadowTreeDelegate_,
+        contextContainer_);
+
+    shadowTree_->commit(
+        [&](RootShadowNode const & /*oldRootShadowNode*/) {
+          return std::static_pointer_cast<RootShadowNode>(
+              rootShadowNode_->ShadowNode::clone({}));
+        },
+        {/* default commit options */});
+  }
+
+  ~CommitRebasingTest() override {
+    CoreFeatures::enableCommitRebasing = false;
+  }
+
+  static Props::Shared propsWithNativeId(std::string nativeId) {
+    auto props = std::make_shared<ViewShadowNodeProps>();
+    props->nativeId = std::move(nativeId);
+    return props;
+  }
+
+  /*
+   * Returns a copy of the tree with the given props set on the node of the
+   * given family.
+   */
+  static RootShadowNode::Unshared cloneWithProps(
+      RootShadowNode const &rootShadowNode,
+      ShadowNodeFamily const &family,
+      Props::Shared const &props) {
+    return std::static_pointer_cast<RootShadowNode>(rootShadowNode.cloneTree(
+        family, [&](ShadowNode const &oldShadowNode) {
+          return oldShadowNode.clone({props});
+        }));
+  }
+
+  Props::Shared currentProps(ShadowNodeFamily const &family) const {
+    auto ancestors = family.getAncestors(
+        *shadowTree_->getCurrentRevision().rootShadowNode);
+    auto const &parent = ancestors.back();
+    return parent.first.get().getChildren().at(parent.second)->getProps();
+  }
+
+  ComponentBuilder builder_;
+  ContextContainer contextContainer_{};
+  CommitRebasingShadowTreeDelegate shadowTreeDelegate_{};
+
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> shadowNodeA_;
+  std::shared_ptr<ViewShadowNode> shadowNodeB_;
+
+  std::unique_ptr<ShadowTree> shadowTree_;
+};
+
+/*
+ * A transaction which lost a race with a commit changing another node is not
+ * run again; its changes are replayed on top of the newer tree.
+ */
+TEST_F(CommitRebasingTest, nonConflictingChangesAreRebased) {
+  auto propsA = propsWithNativeId("A");
+  auto propsB = propsWithNativeId("B");
+  auto numberOfTransactionCalls = 0;
+
+  auto status = shadowTree_->commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        if (numberOfTransactionCalls++ == 0) {
+          // Another commit sneaks in while the transaction is running.
+          shadowTree_->commit(
+              [&](RootShadowNode const &oldRootShadowNode) {
+                return cloneWithProps(
+                    oldRootShadowNode, shadowNodeB_->getFamily(), propsB);
+              },
+              {/* default commit options */});
+        }
+        return cloneWithProps(
+            oldRootShadowNode, shadowNodeA_->getFamily(), propsA);
+      },
+      {/* default commit options */});
+
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(numberOfTransactionCalls, 1);
+  EXPECT_EQ(currentProps(shadowNodeA_->getFamily()), propsA);
+  EXPECT_EQ(currentProps(shadowNodeB_->getFamily()), propsB);
+
+  auto telemetry = shadowTree_->getCurrentRevision().telemetry;
+  EXPECT_EQ(telemetry.getNumberOfCommitRebases(), 1);
+  EXPECT_EQ(telemetry.getNumberOfCommitRetries(), 0);
+}
+
+/*
+ * A transaction which lost a race with a commit changing the same node is run
+ * again on top of the newer tree.
+ */
+TEST_F(CommitRebasingTest, conflictingChangesAreRetried) {
+  auto propsA = propsWithNativeId("A");
+  auto concurrentPropsA = propsWithNativeId("concurrent A");
+  auto numberOfTransactionCalls = 0;
+
+  auto status = shadowTree_->commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        if (numberOfTransactionCalls++ == 0) {
+          shadowTree_->commit(
+              [&](RootShadowNode const &oldRootShadowNode) {
+                return cloneWithProps(
+                    oldRootShadowNode,
+                    shadowNodeA_->getFamily(),
+                    concurrentPropsA);
+              },
+              {/* default commit options */});
+        }
+        return cloneWithProps(
+            oldRootShadowNode, shadowNodeA_->getFamily(), propsA);
+      },
+      {/* default commit options */});
+
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(numberOfTransactionCalls, 2);
+  EXPECT_EQ(currentProps(shadowNodeA_->getFamily()), propsA);
+
+  auto telemetry = shadowTree_->getCurrentRevision().telemetry;
+  EXPECT_EQ(telemetry.getNumberOfCommitRebases(), 0);
+  EXPECT_EQ(telemetry.getNumberOfCommitRetries(), 1);
+}
+
+/*
+ * A transaction which keeps losing races (each rebase of it is overtaken by
+ * yet another commit) is eventually run again from scratch instead of being
+ * rebased indefinitely.
+ */
+TEST_F(CommitRebasingTest, transactionsLosingTooManyRacesAreRetried) {
+  auto propsA = propsWithNativeId("A");
+  auto numberOfTransactionCalls = 0;
+  auto numberOfConcurrentCommits = 0;
+
+  shadowTreeDelegate_.willCommitHook = [&]() {
+    if (numberOfTransactionCalls != 1) {
+      return;
+    }
+    auto propsB =
+        propsWithNativeId("B" + std::to_string(numberOfConcurrentCommits++));
+    shadowTree_->commit(
+        [&](RootShadowNode const &oldRootShadowNode) {
+          return cloneWithProps(
+              oldRootShadowNode, shadowNodeB_->getFamily(), propsB);
+        },
+        {/* default commit options */});
+  };
+
+  auto status = shadowTree_->commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        numberOfTransactionCalls++;
+        return cloneWithProps(
+            oldRootShadowNode, shadowNodeA_->getFamily(), propsA);
+      },
+      {/* default commit options */});
+
+  shadowTreeDelegate_.willCommitHook = nullptr;
+
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(numberOfTransactionCalls, 2);
+  EXPECT_GT(numberOfConcurrentCommits, 1);
+  EXPECT_EQ(currentProps(shadowNodeA_->getFamily()), propsA);
+
+  auto telemetry = shadowTree_->getCurrentRevision().telemetry;
+  EXPECT_EQ(telemetry.getNumberOfCommitRebases(), 0);
+  EXPECT_EQ(telemetry.getNumberOfCommitRetries(), 1);
+}
+
+} // namespace facebook::react
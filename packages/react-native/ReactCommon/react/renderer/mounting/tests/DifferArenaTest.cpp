@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/mounting/DifferArena.h>
+
+using namespace facebook::react;
+
+TEST(DifferArenaTest, testSmallAllocationsShareChunks) {
+  auto arena = DifferArena{};
+
+  for (int i = 0; i < 64; i++) {
+    EXPECT_NE(arena.allocate(24), nullptr);
+  }
+
+  EXPECT_EQ(arena.getNumberOfAllocations(), 64);
+  EXPECT_EQ(arena.getNumberOfHeapAllocations(), 1);
+}
+
+TEST(DifferArenaTest, testFreedMemoryIsReused) {
+  auto arena = DifferArena{};
+
+  auto first = arena.allocate(100);
+  arena.deallocate(first, 100);
+  auto second = arena.allocate(120);
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(arena.getNumberOfAllocations(), 2);
+  EXPECT_EQ(arena.getNumberOfHeapAllocations(), 1);
+}
+
+TEST(DifferArenaTest, testAllocationsAreAligned) {
+  auto arena = DifferArena{};
+
+  for (size_t size = 1; size < 512; size += 7) {
+    auto pointer = reinterpret_cast<uintptr_t>(arena.allocate(size));
+    EXPECT_EQ(pointer % alignof(std::max_align_t), 0u);
+  }
+}
+
+TEST(DifferArenaTest, testBigAllocationsGoToHeap) {
+  auto arena = DifferArena{};
+
+  auto pointer = arena.allocate(1024 * 1024);
+  EXPECT_NE(pointer, nullptr);
+  EXPECT_EQ(arena.getNumberOfHeapAllocations(), 1);
+  arena.deallocate(pointer, 1024 * 1024);
+}
+
+TEST(DifferArenaTest, testContainers) {
+  auto arena = DifferArena{};
+  auto allocator = DifferArenaAllocator<int>{&arena};
+
+  auto vector = std::vector<int, DifferArenaAllocator<int>>{allocator};
+  auto deque = std::deque<int, DifferArenaAllocator<int>>{allocator};
+  for (int i = 0; i < 1000; i++) {
+    vector.push_back(i);
+    deque.push_back(i);
+  }
+
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(vector[i], i);
+    EXPECT_EQ(deque[i], i);
+  }
+
+  EXPECT_GT(arena.getNumberOfAllocations(), arena.getNumberOfHeapAllocations());
+}
+
+TEST(DifferArenaTest, testIncorporate) {
+  auto arena = DifferArena{};
+  auto otherArena = DifferArena{};
+
+  arena.allocate(16);
+  otherArena.allocate(16);
+  otherArena.allocate(16);
+
+  arena.incorporate(otherArena);
+
+  EXPECT_EQ(arena.getNumberOfAllocations(), 3);
+  EXPECT_EQ(arena.getNumberOfHeapAllocations(), 2);
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/CoreFeatures.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      ShadowTree const & /*shadowTree*/,
+      RootShadowNode::Shared const & /*oldRootShadowNode*/,
+      RootShadowNode::Unshared const &newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override{};
+};
+
+/*
+ * Transactions pulled at arbitrary moments (while the speculative diff is in
+ * progress, after it finished, after newer revisions arrived) must always
+ * bring the view tree to the state of the last committed revision.
+ */
+TEST(MountingCoordinatorTest, speculativeDiffingProducesCorrectTransactions) {
+  CoreFeatures::enableSpeculativeDiffing = true;
+
+  auto entropy = Entropy(42);
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  auto shadowTree = std::make_unique<ShadowTree>(
+      SurfaceId{1},
+      LayoutConstraints{
+          Size{512, 0}, Size{512, std::numeric_limits<Float>::infinity()}},
+      LayoutContext{},
+      shadowTreeDelegate,
+      *contextContainer);
+  auto mountingCoordinator = shadowTree->getMountingCoordinator();
+
+  auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(
+      *shadowTree->getCurrentRevision().rootShadowNode);
+
+  auto singleRootChildNode =
+      generateShadowNodeTree(entropy, viewComponentDescriptor, 200);
+  shadowTree->commit(
+      [&](RootShadowNode const &oldRootShadowNode) {
+        return std::make_shared<RootShadowNode>(
+            oldRootShadowNode,
+            ShadowNodeFragment{
+                /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+                /* .children = */
+                std::make_shared<ShadowNode::ListOfShared>(
+                    ShadowNode::ListOfShared{singleRootChildNode}),
+            });
+      },
+      {/* default commit options */});
+
+  for (int i = 0; i < 100; i++) {
+    // Committing a random number of revisions between pulls.
+    auto numberOfCommits = entropy.random<int>(1, 3);
+    for (int j = 0; j < numberOfCommits; j++) {
+      shadowTree->commit(
+          [&](RootShadowNode const &oldRootShadowNode) {
+            auto rootShadowNode = RootShadowNode::Shared{
+                std::static_pointer_cast<RootShadowNode const>(
+                    oldRootShadowNode.ShadowNode::clone({}))};
+            alterShadowTree(
+                entropy,
+                rootShadowNode,
+                {
+                    &messWithChildren,
+                    &messWithYogaStyles,
+                    &messWithLayoutableOnlyFlag,
+                });
+            return std::const_pointer_cast<RootShadowNode>(rootShadowNode);
+          },
+          {/* default commit options */});
+    }
+
+    // Giving the background thread a chance to finish (or not).
+    if (entropy.random<bool>()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto transaction = mountingCoordinator->pullTransaction();
+    ASSERT_TRUE(transaction.has_value());
+    viewTree.mutate(transaction->getMutations());
+
+    auto rebuiltViewTree = buildStubViewTreeWithoutUsingDifferentiator(
+        *shadowTree->getCurrentRevision().rootShadowNode);
+    EXPECT_TRUE(rebuiltViewTree == viewTree);
+  }
+
+  EXPECT_FALSE(mountingCoordinator->pullTransaction().has_value());
+
+  // Revoking (on destruction of the tree) waits for the background thread.
+  shadowTree->commitEmptyTree();
+  shadowTree.reset();
+  EXPECT_FALSE(mountingCoordinator->pullTransaction().has_value());
+
+  CoreFeatures::enableSpeculativeDiffing = false;
+}
+
+} // namespace facebook::react
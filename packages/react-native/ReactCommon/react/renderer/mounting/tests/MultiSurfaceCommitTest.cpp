@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+class MultiSurfaceShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      ShadowTree const & /*shadowTree*/,
+      RootShadowNode::Shared const & /*oldRootShadowNode*/,
+      RootShadowNode::Unshared const &newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override{};
+};
+
+static void collectEventEmitters(
+    ShadowNode const &shadowNode,
+    std::vector<EventEmitter::Shared> &eventEmitters) {
+  for (auto const &childNode : shadowNode.getChildren()) {
+    eventEmitters.push_back(childNode->getEventEmitter());
+    collectEventEmitters(*childNode, eventEmitters);
+  }
+}
+
+/*
+ * Commits to several surfaces in parallel while another thread keeps reading
+ * the mounted state of event emitters (as event dispatching does). Once all
+ * commits are done, exactly the event emitters of nodes of the last committed
+ * trees must be enabled.
+ */
+TEST(MultiSurfaceCommitTest, concurrentCommitsKeepMountedStateConsistent) {
+  auto const numberOfSurfaces = 4;
+  auto const numberOfCommits = 100;
+
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+
+  auto shadowTreeDelegate = MultiSurfaceShadowTreeDelegate{};
+  auto shadowTrees = std::vector<std::unique_ptr<ShadowTree>>{};
+  auto eventEmitters = std::vector<EventEmitter::Shared>{};
+
+  for (int i = 0; i < numberOfSurfaces; i++) {
+    auto entropy = Entropy(i);
+    auto shadowTree = std::make_unique<ShadowTree>(
+        SurfaceId{i + 1},
+        LayoutConstraints{
+            Size{512, 0}, Size{512, std::numeric_limits<Float>::infinity()}},
+        LayoutContext{},
+        shadowTreeDelegate,
+        *contextContainer);
+
+    auto singleRootChildNode =
+        generateShadowNodeTree(entropy, viewComponentDescriptor, 200);
+    shadowTree->commit(
+        [&](RootShadowNode const &oldRootShadowNode) {
+          return std::make_shared<RootShadowNode>(
+              oldRootShadowNode,
+              ShadowNodeFragment{
+                  /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+                  /* .children = */
+                  std::make_shared<ShadowNode::ListOfShared>(
+                      ShadowNode::ListOfShared{singleRootChildNode}),
+              });
+        },
+        {/* default commit options */});
+
+    collectEventEmitters(
+        *shadowTree->getCurrentRevision().rootShadowNode, eventEmitters);
+    shadowTrees.push_back(std::move(shadowTree));
+  }
+
+  auto isCommitting = std::atomic<bool>{true};
+  auto dispatcherThread = std::thread([&]() {
+    auto numberOfEnabledEventEmitters = size_t{0};
+    while (isCommitting.load()) {
+      for (auto const &eventEmitter : eventEmitters) {
+        numberOfEnabledEventEmitters += eventEmitter->isEnabled() ? 1 : 0;
+      }
+    }
+    EXPECT_GT(numberOfEnabledEventEmitters, size_t{0});
+  });
+
+  auto committingThreads = std::vector<std::thread>{};
+  for (int i = 0; i < numberOfSurfaces; i++) {
+    committingThreads.emplace_back([&, i]() {
+      auto entropy = Entropy(numberOfSurfaces + i);
+      for (int j = 0; j < numberOfCommits; j++) {
+        shadowTrees[i]->commit(
+            [&](RootShadowNode const &oldRootShadowNode) {
+              auto rootShadowNode = RootShadowNode::Shared{
+                  std::static_pointer_cast<RootShadowNode const>(
+                      oldRootShadowNode.ShadowNode::clone({}))};
+              alterShadowTree(
+                  entropy,
+                  rootShadowNode,
+                  {
+                      &messWithChildren,
+                      &messWithYogaStyles,
+                      &messWithLayoutableOnlyFlag,
+                  });
+              return std::const_pointer_cast<RootShadowNode>(rootShadowNode);
+            },
+            {/* default commit options */});
+      }
+    });
+  }
+
+  for (auto &committingThread : committingThreads) {
+    committingThread.join();
+  }
+  isCommitting = false;
+  dispatcherThread.join();
+
+  auto mountedEventEmitters = std::vector<EventEmitter::Shared>{};
+  for (auto const &shadowTree : shadowTrees) {
+    collectEventEmitters(
+        *shadowTree->getCurrentRevision().rootShadowNode, mountedEventEmitters);
+  }
+
+  auto mountedEventEmitterSet = std::unordered_set<EventEmitter const *>{};
+  for (auto const &eventEmitter : mountedEventEmitters) {
+    EXPECT_TRUE(eventEmitter->isEnabled());
+    mountedEventEmitterSet.insert(eventEmitter.get());
+  }
+
+  for (auto const &eventEmitter : eventEmitters) {
+    EXPECT_EQ(
+        eventEmitter->isEnabled(),
+        mountedEventEmitterSet.count(eventEmitter.get()) > 0);
+  }
+
+  for (auto const &shadowTree : shadowTrees) {
+    shadowTree->commitEmptyTree();
+  }
+
+  for (auto const &eventEmitter : mountedEventEmitters) {
+    EXPECT_FALSE(eventEmitter->isEnabled());
+  }
+}
+
+} // namespace facebook::react
@@ -12,6 +12,7 @@
 
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/CoreFeatures.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/mounting/Differentiator.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
@@ -26,6 +27,39 @@
 
 namespace facebook::react {
 
+/*
+ * Diffing independent subtrees on the worker pool must produce exactly the
+ * same list of mutations as the serial algorithm.
+ */
+static void expectParallelDiffingToMatchSerial(
+    ShadowNode const &oldRootShadowNode,
+    ShadowNode const &newRootShadowNode,
+    ShadowViewMutation::List const &serialMutations) {
+  CoreFeatures::enableParallelDiffing = true;
+  auto parallelMutations =
+      calculateShadowViewMutations(oldRootShadowNode, newRootShadowNode);
+  CoreFeatures::enableParallelDiffing = false;
+
+  ASSERT_EQ(serialMutations.size(), parallelMutations.size());
+  for (size_t i = 0; i < serialMutations.size(); i++) {
+    auto const &serialMutation = serialMutations[i];
+    auto const &parallelMutation = parallelMutations[i];
+    EXPECT_EQ(serialMutation.type, parallelMutation.type);
+    EXPECT_EQ(serialMutation.index, parallelMutation.index);
+    EXPECT_EQ(
+        serialMutation.isRedundantOperation,
+        parallelMutation.isRedundantOperation);
+    EXPECT_TRUE(
+        serialMutation.parentShadowView == parallelMutation.parentShadowView);
+    EXPECT_TRUE(
+        serialMutation.oldChildShadowView ==
+        parallelMutation.oldChildShadowView);
+    EXPECT_TRUE(
+        serialMutation.newChildShadowView ==
+        parallelMutation.newChildShadowView);
+  }
+}
+
 static void testShadowNodeTreeLifeCycle(
     uint_fast32_t seed,
     int treeSize,
@@ -111,6 +145,9 @@ static void testShadowNodeTreeLifeCycle(
       auto mutations =
           calculateShadowViewMutations(*currentRootNode, *nextRootNode);
 
+      expectParallelDiffingToMatchSerial(
+          *currentRootNode, *nextRootNode, mutations);
+
       // Make sure that in a single frame, a DELETE for a
       // view is not followed by a CREATE for the same view.
       {
@@ -262,6 +299,9 @@ static void testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
       auto mutations =
           calculateShadowViewMutations(*currentRootNode, *nextRootNode);
 
+      expectParallelDiffingToMatchSerial(
+          *currentRootNode, *nextRootNode, mutations);
+
       // Make sure that in a single frame, a DELETE for a
       // view is not followed by a CREATE for the same view.
       {
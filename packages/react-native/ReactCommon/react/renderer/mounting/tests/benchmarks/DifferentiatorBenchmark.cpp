@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/utils/ContextContainer.h>
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace facebook::react {
+
+auto contextContainer = std::make_shared<ContextContainer const>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto componentDescriptorParameters =
+    ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+auto viewComponentDescriptor =
+    ViewComponentDescriptor{componentDescriptorParameters};
+auto rootComponentDescriptor =
+    RootComponentDescriptor{componentDescriptorParameters};
+
+/*
+ * Props which force a view to be concrete (not flattened).
+ */
+static SharedViewProps nonFlattenedProps() {
+  folly::dynamic dynamic = folly::dynamic::object();
+  dynamic["position"] = "absolute";
+  dynamic["width"] = 100;
+  dynamic["height"] = 100;
+  dynamic["nativeId"] = "NativeId";
+  dynamic["accessible"] = true;
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  return std::static_pointer_cast<ViewProps const>(
+      viewComponentDescriptor.cloneProps(
+          parserContext, nullptr, RawProps{dynamic}));
+}
+
+auto viewProps = nonFlattenedProps();
+
+static ShadowNode::Shared makeViewNode(
+    ShadowNodeFamily::Shared const &family,
+    ShadowNode::ListOfShared const &children = {}) {
+  return viewComponentDescriptor.createShadowNode(
+      ShadowNodeFragment{
+          viewProps, std::make_shared<ShadowNode::ListOfShared>(children)},
+      family);
+}
+
+static ShadowNodeFamily::Shared makeFamily(
+    ComponentDescriptor const &componentDescriptor,
+    Tag tag) {
+  return componentDescriptor.createFamily({tag, SurfaceId(1), nullptr}, nullptr);
+}
+
+/*
+ * Builds two trees of shape `root -> list -> rows`, where the list has `size`
+ * rows in the first tree and `transform(rows)` in the second one.
+ */
+static std::pair<ShadowNode::Shared, ShadowNode::Shared> makeWideListTrees(
+    int size,
+    std::function<void(ShadowNode::ListOfShared &rows)> const &transform) {
+  auto rows = ShadowNode::ListOfShared{};
+  rows.reserve(size);
+  for (int i = 0; i < size; i++) {
+    rows.push_back(
+        makeViewNode(makeFamily(viewComponentDescriptor, 100 + i * 2)));
+  }
+
+  auto newRows = rows;
+  transform(newRows);
+
+  auto listFamily = makeFamily(viewComponentDescriptor, 10);
+  auto rootFamily = makeFamily(rootComponentDescriptor, 1);
+
+  auto makeRoot = [&](ShadowNode::ListOfShared const &rows) {
+    return rootComponentDescriptor.createShadowNode(
+        ShadowNodeFragment{
+            RootShadowNode::defaultSharedProps(),
+            std::make_shared<ShadowNode::ListOfShared>(
+                ShadowNode::ListOfShared{makeViewNode(listFamily, rows)})},
+        rootFamily);
+  };
+
+  return {makeRoot(rows), makeRoot(newRows)};
+}
+
+static void runDiffing(
+    benchmark::State &state,
+    std::pair<ShadowNode::Shared, ShadowNode::Shared> const &trees) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        calculateShadowViewMutations(*trees.first, *trees.second));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void wideListReversal(benchmark::State &state) {
+  auto trees = makeWideListTrees(
+      static_cast<int>(state.range(0)), [](ShadowNode::ListOfShared &rows) {
+        std::reverse(rows.begin(), rows.end());
+      });
+  runDiffing(state, trees);
+}
+BENCHMARK(wideListReversal)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void wideListMoveLastToFront(benchmark::State &state) {
+  auto trees = makeWideListTrees(
+      static_cast<int>(state.range(0)), [](ShadowNode::ListOfShared &rows) {
+        std::rotate(rows.rbegin(), rows.rbegin() + 1, rows.rend());
+      });
+  runDiffing(state, trees);
+}
+BENCHMARK(wideListMoveLastToFront)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void wideListInsertionEveryTenthRow(benchmark::State &state) {
+  auto trees = makeWideListTrees(
+      static_cast<int>(state.range(0)), [](ShadowNode::ListOfShared &rows) {
+        auto newRows = ShadowNode::ListOfShared{};
+        for (size_t i = 0; i < rows.size(); i++) {
+          if (i % 10 == 0) {
+            newRows.push_back(makeViewNode(makeFamily(
+                viewComponentDescriptor, static_cast<Tag>(101 + i * 2))));
+          }
+          newRows.push_back(rows[i]);
+        }
+        rows = std::move(newRows);
+      });
+  runDiffing(state, trees);
+}
+BENCHMARK(wideListInsertionEveryTenthRow)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+#include <unistd.h>
+#include <fstream>
+#include <memory>
+
+namespace facebook::react {
+
+/*
+ * Returns the resident set size of the process in bytes (or `0` where
+ * `/proc` is not available).
+ */
+static size_t residentSetSize() {
+  auto statm = std::ifstream("/proc/self/statm");
+  size_t size = 0;
+  size_t resident = 0;
+  statm >> size >> resident;
+  return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+/*
+ * Clones every node of the tree with `props` applied on top of its props.
+ * The nodes are never mounted, so on Android every clone also carries the
+ * raw props of all the previous ones (see
+ * `ShadowNode::propsForClonedShadowNode`).
+ */
+static ShadowNode::Unshared restyleShadowTree(
+    PropsParserContext const &parserContext,
+    ShadowNode const &shadowNode,
+    folly::dynamic const &props) {
+  auto children = std::make_shared<ShadowNode::ListOfShared>();
+  for (auto const &child : shadowNode.getChildren()) {
+    children->push_back(restyleShadowTree(parserContext, *child, props));
+  }
+
+  auto newProps = shadowNode.getComponentDescriptor().cloneProps(
+      parserContext, shadowNode.getProps(), RawProps(props));
+  return shadowNode.clone({newProps, children});
+}
+
+/*
+ * Builds a 10k-node tree, styles every node and then updates one prop of
+ * every node `state.range(0)` times, keeping only the last tree alive.
+ * Reports how much the resident set size grew.
+ * `Props::rawProps` only exists on Android; on other platforms this only
+ * measures the parsed props.
+ */
+static void rawPropsMemoryOfTenThousandNodes(benchmark::State &state) {
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer const>();
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor{ComponentDescriptorParameters{
+          eventDispatcher, contextContainer, nullptr}};
+
+  folly::dynamic style = folly::dynamic::object("flexDirection", "row")(
+      "alignItems", "center")("padding", 8)("marginTop", 4)("width", 100)(
+      "height", 48)("backgroundColor", 4294967295)("borderRadius", 8)(
+      "nativeID", "node")("testID", "node");
+
+  ContextContainer parserContextContainer{};
+  parserContextContainer.insert(
+      "ReactNativeConfig", std::make_shared<EmptyReactNativeConfig const>());
+  PropsParserContext parserContext{-1, parserContextContainer};
+
+  for (auto _ : state) {
+    auto rssBefore = residentSetSize();
+
+    auto entropy = Entropy(0);
+    auto tree = restyleShadowTree(
+        parserContext,
+        *generateShadowNodeTree(entropy, viewComponentDescriptor, 10000),
+        style);
+    for (int i = 0; i < state.range(0); i++) {
+      tree = restyleShadowTree(
+          parserContext, *tree, folly::dynamic::object("opacity", i / 100.0));
+    }
+
+    // Freed memory can make the resident set size shrink.
+    state.counters["RSS (MB)"] = (static_cast<double>(residentSetSize()) -
+                                  static_cast<double>(rssBefore)) /
+        (1024 * 1024);
+    benchmark::DoNotOptimize(tree);
+  }
+}
+BENCHMARK(rawPropsMemoryOfTenThousandNodes)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace facebook::react
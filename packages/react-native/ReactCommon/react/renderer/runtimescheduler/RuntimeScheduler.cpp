@@ -8,11 +8,22 @@
 #include "RuntimeScheduler.h"
 #include "SchedulerPriorityUtils.h"
 
+#include <algorithm>
 #include <utility>
 #include "ErrorUtils.h"
 
 namespace facebook::react {
 
+namespace {
+
+/*
+ * Idle periods are capped (as on the web) so that work scheduled during one
+ * isn't delayed for too long.
+ */
+constexpr auto kMaxIdlePeriod = std::chrono::milliseconds(50);
+
+} // namespace
+
 #pragma mark - Public
 
 RuntimeScheduler::RuntimeScheduler(
@@ -34,9 +45,10 @@ void RuntimeScheduler::scheduleWork(RawCallback callback) const {
 std::shared_ptr<Task> RuntimeScheduler::scheduleTask(
     SchedulerPriority priority,
     jsi::Function callback) {
-  auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  auto now = now_();
+  auto expirationTime = now + timeoutForSchedulerPriority(priority);
+  auto task = taskPool_.create(priority, std::move(callback), expirationTime);
+  task->enqueueTime = now;
   taskQueue_.push(task);
 
   scheduleWorkLoopIfNecessary();
@@ -47,9 +59,10 @@ std::shared_ptr<Task> RuntimeScheduler::scheduleTask(
 std::shared_ptr<Task> RuntimeScheduler::scheduleTask(
     SchedulerPriority priority,
     RawCallback callback) {
-  auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  auto now = now_();
+  auto expirationTime = now + timeoutForSchedulerPriority(priority);
+  auto task = taskPool_.create(priority, std::move(callback), expirationTime);
+  task->enqueueTime = now;
   taskQueue_.push(task);
 
   scheduleWorkLoopIfNecessary();
@@ -57,8 +70,90 @@ std::shared_ptr<Task> RuntimeScheduler::scheduleTask(
   return task;
 }
 
+std::shared_ptr<Task> RuntimeScheduler::scheduleTaskFromAnyThread(
+    SchedulerPriority priority,
+    RawCallback callback) {
+  auto now = now_();
+  auto expirationTime = now + timeoutForSchedulerPriority(priority);
+  auto task = taskPool_.create(priority, std::move(callback), expirationTime);
+  task->enqueueTime = now;
+  taskIntakeQueue_.push(task);
+
+  scheduleWorkLoopIfNecessary();
+
+  return task;
+}
+
+std::shared_ptr<Task> RuntimeScheduler::scheduleIdleTask(
+    jsi::Function callback,
+    std::optional<RuntimeSchedulerDuration> timeout) {
+  auto now = now_();
+  auto expirationTime =
+      timeout ? now + *timeout : RuntimeSchedulerTimePoint::max();
+  auto task = taskPool_.create(
+      SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
+  task->enqueueTime = now;
+  task->isIdleTask = true;
+  idleTaskQueue_.push(task);
+  hasIdleTasks_ = true;
+
+  scheduleWorkLoopIfNecessary();
+
+  return task;
+}
+
+std::shared_ptr<Task> RuntimeScheduler::scheduleIdleTask(
+    RawCallback callback,
+    std::optional<RuntimeSchedulerDuration> timeout) {
+  auto now = now_();
+  auto expirationTime =
+      timeout ? now + *timeout : RuntimeSchedulerTimePoint::max();
+  auto task = taskPool_.create(
+      SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
+  task->enqueueTime = now;
+  task->isIdleTask = true;
+  idleTaskQueue_.push(task);
+  hasIdleTasks_ = true;
+
+  scheduleWorkLoopIfNecessary();
+
+  return task;
+}
+
+RuntimeSchedulerDuration RuntimeScheduler::getIdleTimeRemaining()
+    const noexcept {
+  auto now = now_();
+  return idleDeadline_ > now ? idleDeadline_ - now
+                             : RuntimeSchedulerDuration::zero();
+}
+
 bool RuntimeScheduler::getShouldYield() const noexcept {
-  return runtimeAccessRequests_ > 0;
+  return runtimeAccessRequests_ > 0 ||
+      (isPerformingWork_ && now_() >= yieldTime_.load());
+}
+
+void RuntimeScheduler::setTimeSlice(
+    RuntimeSchedulerDuration timeSlice) noexcept {
+  timeSlice_ = timeSlice;
+}
+
+void RuntimeScheduler::onFrame(RuntimeSchedulerTimePoint frameTime) noexcept {
+  // Intervals much longer than a frame mean that frames were skipped (or
+  // that nothing was drawn for a while) and don't tell anything about the
+  // refresh rate.
+  auto frameInterval = frameTime - lastFrameTime_;
+  if (frameInterval >= std::chrono::milliseconds(4) &&
+      frameInterval <= std::chrono::milliseconds(34)) {
+    frameInterval_ = frameInterval;
+  }
+
+  lastFrameTime_ = frameTime;
+  frameDeadline_ = frameTime + frameInterval_;
+
+  // A new idle period starts after the frame.
+  if (hasIdleTasks_) {
+    scheduleWorkLoopIfNecessary();
+  }
 }
 
 bool RuntimeScheduler::getIsSynchronous() const noexcept {
@@ -67,6 +162,11 @@ bool RuntimeScheduler::getIsSynchronous() const noexcept {
 
 void RuntimeScheduler::cancelTask(Task &task) noexcept {
   task.callback.reset();
+  if (task.isIdleTask) {
+    idleTaskQueue_.remove(task);
+  } else {
+    taskQueue_.remove(task);
+  }
 }
 
 SchedulerPriority RuntimeScheduler::getCurrentPriorityLevel() const noexcept {
@@ -77,6 +177,16 @@ RuntimeSchedulerTimePoint RuntimeScheduler::now() const noexcept {
   return now_();
 }
 
+RuntimeSchedulerHistogram const &RuntimeScheduler::getQueueingLatencyHistogram(
+    SchedulerPriority priority) const noexcept {
+  return queueingLatencyHistograms_[serialize(priority) - 1];
+}
+
+RuntimeSchedulerHistogram const &RuntimeScheduler::getExecutionTimeHistogram(
+    SchedulerPriority priority) const noexcept {
+  return executionTimeHistograms_[serialize(priority) - 1];
+}
+
 void RuntimeScheduler::executeNowOnTheSameThread(RawCallback callback) {
   runtimeAccessRequests_ += 1;
   executeSynchronouslyOnSameThread_CAN_DEADLOCK(
@@ -97,6 +207,7 @@ void RuntimeScheduler::executeNowOnTheSameThread(RawCallback callback) {
 void RuntimeScheduler::callExpiredTasks(jsi::Runtime &runtime) {
   auto previousPriority = currentPriority_;
   try {
+    drainTaskIntakeQueue();
     while (!taskQueue_.empty()) {
       auto topPriorityTask = taskQueue_.top();
       auto now = now_();
@@ -106,17 +217,7 @@ void RuntimeScheduler::callExpiredTasks(jsi::Runtime &runtime) {
         break;
       }
 
-      currentPriority_ = topPriorityTask->priority;
-      auto result = topPriorityTask->execute(runtime, didUserCallbackTimeout);
-
-      if (result.isObject() && result.getObject(runtime).isFunction(runtime)) {
-        topPriorityTask->callback =
-            result.getObject(runtime).getFunction(runtime);
-      } else {
-        if (taskQueue_.top() == topPriorityTask) {
-          taskQueue_.pop();
-        }
-      }
+      executeTask(runtime, topPriorityTask, didUserCallbackTimeout, now);
     }
   } catch (jsi::JSError &error) {
     handleFatalError(runtime, error);
@@ -128,8 +229,9 @@ void RuntimeScheduler::callExpiredTasks(jsi::Runtime &runtime) {
 #pragma mark - Private
 
 void RuntimeScheduler::scheduleWorkLoopIfNecessary() const {
-  if (!isWorkLoopScheduled_ && !isPerformingWork_) {
-    isWorkLoopScheduled_ = true;
+  // Can be called from multiple threads at once; only one of them schedules
+  // the work loop.
+  if (!isPerformingWork_ && !isWorkLoopScheduled_.exchange(true)) {
     runtimeExecutor_([this](jsi::Runtime &runtime) {
       isWorkLoopScheduled_ = false;
       startWorkLoop(runtime);
@@ -140,35 +242,201 @@ void RuntimeScheduler::scheduleWorkLoopIfNecessary() const {
 void RuntimeScheduler::startWorkLoop(jsi::Runtime &runtime) const {
   auto previousPriority = currentPriority_;
   isPerformingWork_ = true;
+  auto didUseUpTimeSlice = false;
+  auto shouldResumeIdleTasks = false;
   try {
+    // The loop yields once its time slice is used up or the host platform is
+    // about to start a new frame, whichever comes first.
+    auto now = now_();
+    auto yieldTime = now + timeSlice_.load();
+    auto frameDeadline = frameDeadline_.load();
+    if (frameDeadline > now) {
+      yieldTime = std::min(yieldTime, frameDeadline);
+    }
+    yieldTime_ = yieldTime;
+
+    auto didExecuteTask = false;
+    drainTaskIntakeQueue();
     while (!taskQueue_.empty()) {
       auto topPriorityTask = taskQueue_.top();
-      auto now = now_();
+      now = now_();
       auto didUserCallbackTimeout = topPriorityTask->expirationTime <= now;
 
-      if (!didUserCallbackTimeout && getShouldYield()) {
+      if (!didUserCallbackTimeout && runtimeAccessRequests_ > 0) {
         // This currentTask hasn't expired, and we need to yield.
         break;
       }
 
-      currentPriority_ = topPriorityTask->priority;
-      auto result = topPriorityTask->execute(runtime, didUserCallbackTimeout);
-
-      if (result.isObject() && result.getObject(runtime).isFunction(runtime)) {
-        topPriorityTask->callback =
-            result.getObject(runtime).getFunction(runtime);
-      } else {
-        if (taskQueue_.top() == topPriorityTask) {
-          taskQueue_.pop();
-        }
+      if (!didUserCallbackTimeout && didExecuteTask && now >= yieldTime) {
+        // This currentTask hasn't expired, and the time slice is over.
+        // At least one task is executed per loop to guarantee progress.
+        didUseUpTimeSlice = true;
+        break;
       }
+
+      executeTask(runtime, topPriorityTask, didUserCallbackTimeout, now);
+      didExecuteTask = true;
+
+      // Tasks scheduled from other threads in the meantime may be more urgent
+      // than the remaining ones.
+      drainTaskIntakeQueue();
+    }
+
+    if (runtimeAccessRequests_ == 0) {
+      shouldResumeIdleTasks = executeIdleTasks(runtime);
     }
   } catch (jsi::JSError &error) {
     handleFatalError(runtime, error);
   }
 
   currentPriority_ = previousPriority;
+  idleDeadline_ = {};
+  hasIdleTasks_ = !idleTaskQueue_.empty();
   isPerformingWork_ = false;
+
+  // Unlike yielding to the host platform, which resumes the work loop once
+  // it's done with the runtime, remaining tasks have to be scheduled again.
+  // Tasks scheduled from other threads while the loop was finishing (and
+  // therefore didn't schedule a new one) are picked up the same way.
+  if (didUseUpTimeSlice || shouldResumeIdleTasks ||
+      !taskIntakeQueue_.empty()) {
+    scheduleWorkLoopIfNecessary();
+  }
+}
+
+void RuntimeScheduler::drainTaskIntakeQueue() const {
+  if (taskIntakeQueue_.empty()) {
+    return;
+  }
+
+  taskIntakeQueue_.drain([this](std::shared_ptr<Task> task) {
+    // Tasks cancelled before reaching the queue are dropped.
+    if (task->callback) {
+      taskQueue_.push(std::move(task));
+    }
+  });
+}
+
+void RuntimeScheduler::executeTask(
+    jsi::Runtime &runtime,
+    std::shared_ptr<Task> const &task,
+    bool didUserCallbackTimeout,
+    RuntimeSchedulerTimePoint now) const {
+  // Cancelled tasks don't skew the histograms.
+  auto isCancelled = !task->callback;
+  auto priorityIndex = serialize(task->priority) - 1;
+
+  if (!isCancelled) {
+    queueingLatencyHistograms_[priorityIndex].record(now - task->enqueueTime);
+  }
+
+  currentPriority_ = task->priority;
+  auto result = task->execute(runtime, didUserCallbackTimeout);
+
+  auto didExecuteAt = now_();
+  if (!isCancelled) {
+    executionTimeHistograms_[priorityIndex].record(didExecuteAt - now);
+  }
+
+  if (result.isObject() && result.getObject(runtime).isFunction(runtime)) {
+    task->callback = result.getObject(runtime).getFunction(runtime);
+    task->enqueueTime = didExecuteAt;
+
+    // As in the JavaScript scheduler, a continuation returned by a task which
+    // was cancelled while running still runs. Cancelling removed the task
+    // from the queue though, so it has to be queued again.
+    if (task->queueIndex == Task::kNotQueued) {
+      taskQueue_.push(task);
+    }
+  } else {
+    taskQueue_.remove(*task);
+  }
+}
+
+bool RuntimeScheduler::executeIdleTasks(jsi::Runtime &runtime) const {
+  if (idleTaskQueue_.empty()) {
+    return false;
+  }
+
+  // The idle period lasts until the estimated start of the next frame. While
+  // a frame is overdue there's no idle time; `onFrame` schedules the work loop
+  // once it comes. If no frames have been reported recently, idle periods
+  // follow one another.
+  auto now = now_();
+  auto frameDeadline = frameDeadline_.load();
+  auto isExpectingFrame = frameDeadline != RuntimeSchedulerTimePoint{} &&
+      now < frameDeadline + kMaxIdlePeriod;
+  auto idleDeadline = now + kMaxIdlePeriod;
+  if (isExpectingFrame) {
+    idleDeadline = std::min(idleDeadline, std::max(frameDeadline, now));
+  }
+
+  idleDeadline_ = idleDeadline;
+  yieldTime_ = idleDeadline;
+
+  while (!idleTaskQueue_.empty() && runtimeAccessRequests_ == 0) {
+    drainTaskIntakeQueue();
+
+    auto topIdleTask = idleTaskQueue_.top();
+    now = now_();
+    auto didTimeout = topIdleTask->expirationTime <= now;
+
+    if (!didTimeout && (now >= idleDeadline || !taskQueue_.empty())) {
+      // The idle period is over or there's other work to do.
+      break;
+    }
+
+    executeIdleTask(runtime, topIdleTask, didTimeout, now);
+  }
+
+  if (runtimeAccessRequests_ > 0) {
+    // The host platform resumes the work loop once it's done.
+    return false;
+  }
+
+  return !taskQueue_.empty() || (!idleTaskQueue_.empty() && !isExpectingFrame);
+}
+
+void RuntimeScheduler::executeIdleTask(
+    jsi::Runtime &runtime,
+    std::shared_ptr<Task> const &task,
+    bool didTimeout,
+    RuntimeSchedulerTimePoint now) const {
+  auto priorityIndex = serialize(SchedulerPriority::IdlePriority) - 1;
+  queueingLatencyHistograms_[priorityIndex].record(now - task->enqueueTime);
+
+  // Idle tasks have no continuations, so the task can be removed before it's
+  // executed.
+  idleTaskQueue_.remove(*task);
+
+  currentPriority_ = SchedulerPriority::IdlePriority;
+  if (task->callback && task->callback->index() == 0) {
+    auto idleDeadline = jsi::Object(runtime);
+    idleDeadline.setProperty(runtime, "didTimeout", didTimeout);
+    idleDeadline.setProperty(
+        runtime,
+        "timeRemaining",
+        jsi::Function::createFromHostFunction(
+            runtime,
+            jsi::PropNameID::forAscii(runtime, "timeRemaining"),
+            0,
+            [this](
+                jsi::Runtime &,
+                jsi::Value const &,
+                jsi::Value const *,
+                size_t) noexcept -> jsi::Value {
+              auto timeRemaining =
+                  std::chrono::duration<double, std::milli>(
+                      getIdleTimeRemaining())
+                      .count();
+              return {timeRemaining};
+            }));
+    task->execute(runtime, jsi::Value(runtime, idleDeadline));
+  } else {
+    task->execute(runtime, didTimeout);
+  }
+
+  executionTimeHistograms_[priorityIndex].record(now_() - now);
 }
 
 } // namespace facebook::react
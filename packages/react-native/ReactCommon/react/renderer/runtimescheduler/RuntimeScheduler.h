@@ -9,10 +9,15 @@
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerHistogram.h>
 #include <react/renderer/runtimescheduler/Task.h>
+#include <react/renderer/runtimescheduler/TaskIntakeQueue.h>
+#include <react/renderer/runtimescheduler/TaskPool.h>
+#include <react/renderer/runtimescheduler/TaskQueue.h>
+#include <array>
 #include <atomic>
 #include <memory>
-#include <queue>
+#include <optional>
 
 namespace facebook {
 namespace react {
@@ -61,7 +66,52 @@ class RuntimeScheduler final {
       RawCallback callback);
 
   /*
-   * Cancelled task will never be executed.
+   * Adds a native callback to priority queue with given priority.
+   * Triggers workloop if needed.
+   *
+   * Unlike `scheduleTask`, can be called from any thread: the task is handed
+   * over through a lock-free queue and moved into the priority queue by the
+   * next work loop. The returned task can only be cancelled on the JavaScript
+   * thread.
+   */
+  std::shared_ptr<Task> scheduleTaskFromAnyThread(
+      SchedulerPriority priority,
+      RawCallback callback);
+
+  /*
+   * Adds a callback to be executed when the scheduler is idle (like
+   * `requestIdleCallback` on the web): once there are no other tasks to
+   * execute, in the time left until the estimated start of the next frame
+   * (see `onFrame`), but for no longer than 50ms. Idle tasks with a timeout
+   * are executed first and, once the timeout elapses, even if there's no idle
+   * time. The others are executed in order of scheduling.
+   *
+   * JavaScript callbacks receive an `IdleDeadline`-like object; native ones
+   * can call `getIdleTimeRemaining`. Idle tasks are cancelled with
+   * `cancelTask`.
+   *
+   * Thread synchronization must be enforced externally.
+   */
+  std::shared_ptr<Task> scheduleIdleTask(
+      jsi::Function callback,
+      std::optional<RuntimeSchedulerDuration> timeout = std::nullopt);
+
+  std::shared_ptr<Task> scheduleIdleTask(
+      RawCallback callback,
+      std::optional<RuntimeSchedulerDuration> timeout = std::nullopt);
+
+  /*
+   * Returns how much time is left in the current idle period. Designed to be
+   * called from idle tasks, which should return once it runs out. Returns
+   * zero outside of idle periods.
+   *
+   * Thread synchronization must be enforced externally.
+   */
+  RuntimeSchedulerDuration getIdleTimeRemaining() const noexcept;
+
+  /*
+   * Cancelled task will never be executed. It is removed from the queue
+   * right away.
    *
    * Operates on JSI object.
    * Thread synchronization must be enforced externally.
@@ -70,12 +120,30 @@ class RuntimeScheduler final {
 
   /*
    * Return value indicates if host platform has a pending access to the
-   * runtime.
+   * runtime or if the work loop used up its time slice.
    *
    * Can be called from any thread.
    */
   bool getShouldYield() const noexcept;
 
+  /*
+   * Sets for how long the work loop can run tasks which haven't expired
+   * before yielding the runtime to the host platform. 5ms by default.
+   *
+   * Can be called from any thread.
+   */
+  void setTimeSlice(RuntimeSchedulerDuration timeSlice) noexcept;
+
+  /*
+   * Informs the scheduler that the host platform started a new frame (e.g. on
+   * vsync). The work loop yields before the estimated start of the next frame
+   * even if its time slice hasn't been used up yet. The frame interval is
+   * estimated from subsequent calls. Idle tasks are executed between frames.
+   *
+   * Must be called from a single thread (usually the main one).
+   */
+  void onFrame(RuntimeSchedulerTimePoint frameTime) noexcept;
+
   /*
    * Return value informs if the current task is executed inside synchronous
    * block.
@@ -109,12 +177,51 @@ class RuntimeScheduler final {
    */
   void callExpiredTasks(jsi::Runtime &runtime);
 
+  /*
+   * Histogram of times which tasks of given priority spent in the queue
+   * before being executed (continuations are measured from the moment they
+   * were returned).
+   *
+   * Can be called from any thread.
+   */
+  RuntimeSchedulerHistogram const &getQueueingLatencyHistogram(
+      SchedulerPriority priority) const noexcept;
+
+  /*
+   * Histogram of execution times of tasks of given priority.
+   *
+   * Can be called from any thread.
+   */
+  RuntimeSchedulerHistogram const &getExecutionTimeHistogram(
+      SchedulerPriority priority) const noexcept;
+
  private:
-  mutable std::priority_queue<
-      std::shared_ptr<Task>,
-      std::vector<std::shared_ptr<Task>>,
-      TaskPriorityComparer>
-      taskQueue_;
+  static constexpr size_t kNumberOfPriorities = 5;
+
+  mutable TaskQueue taskQueue_;
+
+  /*
+   * Tasks scheduled from other threads, waiting to be moved to `taskQueue_`.
+   */
+  mutable TaskIntakeQueue taskIntakeQueue_;
+
+  /*
+   * Tasks scheduled with `scheduleIdleTask`, ordered by their timeouts.
+   */
+  mutable TaskQueue idleTaskQueue_;
+
+  /*
+   * Set while there are idle tasks waiting for an idle period, so that
+   * `onFrame` can schedule the work loop.
+   */
+  mutable std::atomic_bool hasIdleTasks_{false};
+
+  /*
+   * End of the idle period in which idle tasks are being executed.
+   */
+  mutable RuntimeSchedulerTimePoint idleDeadline_{};
+
+  TaskPool taskPool_;
 
   RuntimeExecutor const runtimeExecutor_;
   mutable SchedulerPriority currentPriority_{SchedulerPriority::NormalPriority};
@@ -128,6 +235,30 @@ class RuntimeScheduler final {
 
   void startWorkLoop(jsi::Runtime &runtime) const;
 
+  /*
+   * Moves tasks scheduled from other threads to `taskQueue_`.
+   */
+  void drainTaskIntakeQueue() const;
+
+  void executeTask(
+      jsi::Runtime &runtime,
+      std::shared_ptr<Task> const &task,
+      bool didUserCallbackTimeout,
+      RuntimeSchedulerTimePoint now) const;
+
+  /*
+   * Executes idle tasks which timed out and, if there's no other work, the
+   * others until the end of the idle period. Returns true if the work loop
+   * has to be scheduled again.
+   */
+  bool executeIdleTasks(jsi::Runtime &runtime) const;
+
+  void executeIdleTask(
+      jsi::Runtime &runtime,
+      std::shared_ptr<Task> const &task,
+      bool didTimeout,
+      RuntimeSchedulerTimePoint now) const;
+
   /*
    * Schedules a work loop unless it has been already scheduled
    * This is to avoid unnecessary calls to `runtimeExecutor`.
@@ -150,6 +281,31 @@ class RuntimeScheduler final {
    * This flag is set while performing work, to prevent re-entrancy.
    */
   mutable std::atomic_bool isPerformingWork_{false};
+
+  std::atomic<RuntimeSchedulerDuration> timeSlice_{
+      std::chrono::milliseconds(5)};
+
+  /*
+   * Time at which the work loop currently being performed has to yield.
+   */
+  mutable std::atomic<RuntimeSchedulerTimePoint> yieldTime_{
+      RuntimeSchedulerTimePoint::max()};
+
+  /*
+   * Estimated start of the next frame of the host platform.
+   */
+  std::atomic<RuntimeSchedulerTimePoint> frameDeadline_{};
+
+  /*
+   * Used by `onFrame` only.
+   */
+  RuntimeSchedulerTimePoint lastFrameTime_{};
+  RuntimeSchedulerDuration frameInterval_{std::chrono::microseconds(16'667)};
+
+  mutable std::array<RuntimeSchedulerHistogram, kNumberOfPriorities>
+      queueingLatencyHistograms_{};
+  mutable std::array<RuntimeSchedulerHistogram, kNumberOfPriorities>
+      executionTimeHistograms_{};
 };
 
 } // namespace react
@@ -12,6 +12,7 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <utility>
 
 namespace facebook::react {
@@ -104,6 +105,53 @@ jsi::Value RuntimeSchedulerBinding::get(
         });
   }
 
+  if (propertyName == "requestIdleCallback") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        2,
+        [this](
+            jsi::Runtime &runtime,
+            jsi::Value const &,
+            jsi::Value const *arguments,
+            size_t count) noexcept -> jsi::Value {
+          auto callback = arguments[0].getObject(runtime).getFunction(runtime);
+
+          // The second argument is an optional `{timeout}` object (in
+          // milliseconds); non-positive timeouts are ignored.
+          auto timeout = std::optional<RuntimeSchedulerDuration>{};
+          if (count > 1 && arguments[1].isObject()) {
+            auto timeoutValue =
+                arguments[1].getObject(runtime).getProperty(runtime, "timeout");
+            if (timeoutValue.isNumber() && timeoutValue.getNumber() > 0) {
+              timeout = std::chrono::duration_cast<RuntimeSchedulerDuration>(
+                  std::chrono::duration<double, std::milli>(
+                      timeoutValue.getNumber()));
+            }
+          }
+
+          auto task =
+              runtimeScheduler_->scheduleIdleTask(std::move(callback), timeout);
+
+          return valueFromTask(runtime, task);
+        });
+  }
+
+  if (propertyName == "cancelIdleCallback") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        1,
+        [this](
+            jsi::Runtime &runtime,
+            jsi::Value const &,
+            jsi::Value const *arguments,
+            size_t) noexcept -> jsi::Value {
+          runtimeScheduler_->cancelTask(*taskFromValue(runtime, arguments[0]));
+          return jsi::Value::undefined();
+        });
+  }
+
   if (propertyName == "unstable_shouldYield") {
     return jsi::Function::createFromHostFunction(
         runtime,
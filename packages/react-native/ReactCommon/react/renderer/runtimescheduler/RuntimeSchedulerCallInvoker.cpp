@@ -33,7 +33,7 @@ void RuntimeSchedulerCallInvoker::invokeAsync(
     SchedulerPriority priority,
     CallFunc &&func) {
   if (auto runtimeScheduler = runtimeScheduler_.lock()) {
-    runtimeScheduler->scheduleTask(
+    runtimeScheduler->scheduleTaskFromAnyThread(
         priority, [func = std::move(func)](jsi::Runtime &) { func(); });
   }
 }
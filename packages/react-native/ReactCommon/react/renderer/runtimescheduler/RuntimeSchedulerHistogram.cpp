@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RuntimeSchedulerHistogram.h"
+
+#include <cmath>
+
+namespace facebook::react {
+
+void RuntimeSchedulerHistogram::record(
+    RuntimeSchedulerDuration duration) noexcept {
+  auto microseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+  auto index = size_t{0};
+  while (microseconds > 0 && index < kNumberOfBuckets - 1) {
+    microseconds >>= 1;
+    index++;
+  }
+
+  buckets_[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t RuntimeSchedulerHistogram::getCount() const noexcept {
+  auto count = uint64_t{0};
+  for (auto const &bucket : buckets_) {
+    count += bucket.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+std::array<uint64_t, RuntimeSchedulerHistogram::kNumberOfBuckets>
+RuntimeSchedulerHistogram::getBucketCounts() const noexcept {
+  auto bucketCounts = std::array<uint64_t, kNumberOfBuckets>{};
+  for (size_t index = 0; index < kNumberOfBuckets; index++) {
+    bucketCounts[index] = buckets_[index].load(std::memory_order_relaxed);
+  }
+  return bucketCounts;
+}
+
+RuntimeSchedulerDuration RuntimeSchedulerHistogram::getBucketUpperBound(
+    size_t index) noexcept {
+  if (index >= kNumberOfBuckets - 1) {
+    return RuntimeSchedulerDuration::max();
+  }
+  return std::chrono::microseconds(int64_t{1} << index);
+}
+
+RuntimeSchedulerDuration RuntimeSchedulerHistogram::getPercentile(
+    double percentile) const noexcept {
+  auto bucketCounts = getBucketCounts();
+
+  auto count = uint64_t{0};
+  for (auto bucketCount : bucketCounts) {
+    count += bucketCount;
+  }
+
+  if (count == 0) {
+    return RuntimeSchedulerDuration::zero();
+  }
+
+  auto rank = static_cast<uint64_t>(std::ceil(percentile * count));
+  auto accumulatedCount = uint64_t{0};
+  for (size_t index = 0; index < kNumberOfBuckets; index++) {
+    accumulatedCount += bucketCounts[index];
+    if (accumulatedCount >= rank && accumulatedCount > 0) {
+      return getBucketUpperBound(index);
+    }
+  }
+
+  return getBucketUpperBound(kNumberOfBuckets - 1);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace facebook::react {
+
+/*
+ * Histogram of durations with exponentially growing buckets: the first bucket
+ * counts durations shorter than 1 microsecond, bucket `i` counts durations in
+ * [2^(i-1), 2^i) microseconds, and the last one counts everything longer.
+ * Recording is wait-free; can be recorded and read on any thread.
+ */
+class RuntimeSchedulerHistogram final {
+ public:
+  static constexpr size_t kNumberOfBuckets = 26;
+
+  RuntimeSchedulerHistogram() = default;
+
+  /*
+   * Not copyable.
+   */
+  RuntimeSchedulerHistogram(RuntimeSchedulerHistogram const &) = delete;
+  RuntimeSchedulerHistogram &operator=(RuntimeSchedulerHistogram const &) =
+      delete;
+
+  void record(RuntimeSchedulerDuration duration) noexcept;
+
+  /*
+   * Returns the number of recorded durations.
+   */
+  uint64_t getCount() const noexcept;
+
+  /*
+   * Returns the number of durations recorded in each bucket.
+   */
+  std::array<uint64_t, kNumberOfBuckets> getBucketCounts() const noexcept;
+
+  /*
+   * Returns the (exclusive) upper bound of durations counted in the bucket.
+   */
+  static RuntimeSchedulerDuration getBucketUpperBound(size_t index) noexcept;
+
+  /*
+   * Returns an upper estimate of the given percentile (between 0 and 1), i.e.
+   * the upper bound of the bucket the percentile falls into. Returns zero if
+   * nothing was recorded.
+   */
+  RuntimeSchedulerDuration getPercentile(double percentile) const noexcept;
+
+ private:
+  std::array<std::atomic<uint64_t>, kNumberOfBuckets> buckets_{};
+};
+
+} // namespace facebook::react
@@ -17,7 +17,7 @@
 namespace facebook::react {
 
 class RuntimeScheduler;
-class TaskPriorityComparer;
+class TaskQueue;
 
 using RawCallback = std::function<void(jsi::Runtime &)>;
 
@@ -34,22 +34,36 @@ struct Task final : public jsi::NativeState {
 
  private:
   friend RuntimeScheduler;
-  friend TaskPriorityComparer;
+  friend TaskQueue;
+
+  static constexpr size_t kNotQueued = static_cast<size_t>(-1);
 
   SchedulerPriority priority;
   std::optional<std::variant<jsi::Function, RawCallback>> callback;
   RuntimeSchedulerClock::time_point expirationTime;
 
+  /*
+   * Time at which the task (or its continuation) was queued.
+   */
+  RuntimeSchedulerClock::time_point enqueueTime;
+
+  /*
+   * Position of the task in `TaskQueue` and the order in which it was queued.
+   */
+  size_t queueIndex{kNotQueued};
+  uint64_t sequenceNumber{0};
+
+  /*
+   * Set for tasks scheduled with `RuntimeScheduler::scheduleIdleTask`.
+   */
+  bool isIdleTask{false};
+
   jsi::Value execute(jsi::Runtime &runtime, bool didUserCallbackTimeout);
-};
 
-class TaskPriorityComparer {
- public:
-  inline bool operator()(
-      std::shared_ptr<Task> const &lhs,
-      std::shared_ptr<Task> const &rhs) {
-    return lhs->expirationTime > rhs->expirationTime;
-  }
+  /*
+   * Executes the task passing `argument` to the JavaScript callback.
+   */
+  jsi::Value execute(jsi::Runtime &runtime, jsi::Value const &argument);
 };
 
 } // namespace facebook::react
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TaskIntakeQueue.h"
+
+namespace facebook::react {
+
+TaskIntakeQueue::~TaskIntakeQueue() {
+  drain([](std::shared_ptr<Task> /*task*/) {});
+}
+
+void TaskIntakeQueue::push(std::shared_ptr<Task> task) {
+  auto node = new Node{std::move(task), head_.load(std::memory_order_relaxed)};
+
+  // Sequentially consistent, so a producer which pushed a task and then sees
+  // that no work loop is running can't miss a work loop which has just
+  // finished without seeing the task (see `RuntimeScheduler::startWorkLoop`).
+  while (!head_.compare_exchange_weak(node->next, node)) {
+  }
+}
+
+bool TaskIntakeQueue::empty() const noexcept {
+  return head_.load() == nullptr;
+}
+
+TaskIntakeQueue::Node *TaskIntakeQueue::takeAll() noexcept {
+  auto node = head_.exchange(nullptr);
+
+  // The stack holds the most recently pushed task on top; reversing it.
+  Node *reversed = nullptr;
+  while (node != nullptr) {
+    auto next = node->next;
+    node->next = reversed;
+    reversed = node;
+    node = next;
+  }
+
+  return reversed;
+}
+
+} // namespace facebook::react
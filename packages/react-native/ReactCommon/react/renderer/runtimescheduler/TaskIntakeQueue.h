@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/Task.h>
+#include <atomic>
+#include <memory>
+
+namespace facebook::react {
+
+/*
+ * Lock-free multi-producer single-consumer queue which hands tasks created on
+ * any thread over to the JavaScript thread. Producers push tasks onto an
+ * intrusive stack with a single compare-and-swap. The consumer takes the
+ * whole stack at once with a single exchange (which makes it immune to the
+ * ABA problem) and restores the order in which the tasks were pushed.
+ */
+class TaskIntakeQueue final {
+ public:
+  TaskIntakeQueue() = default;
+  ~TaskIntakeQueue();
+
+  /*
+   * Not copyable.
+   */
+  TaskIntakeQueue(TaskIntakeQueue const &) = delete;
+  TaskIntakeQueue &operator=(TaskIntakeQueue const &) = delete;
+
+  /*
+   * Can be called from any thread.
+   */
+  void push(std::shared_ptr<Task> task);
+
+  /*
+   * Can be called from any thread.
+   */
+  bool empty() const noexcept;
+
+  /*
+   * Calls `callback` for every task pushed so far, in the order of pushing.
+   * Must be called from a single (consumer) thread.
+   */
+  template <typename CallbackT>
+  void drain(CallbackT &&callback) {
+    auto node = takeAll();
+    while (node != nullptr) {
+      auto next = node->next;
+      callback(std::move(node->task));
+      delete node;
+      node = next;
+    }
+  }
+
+ private:
+  struct Node {
+    std::shared_ptr<Task> task;
+    Node *next;
+  };
+
+  /*
+   * Detaches all pushed nodes and returns them as a list in the order of
+   * pushing.
+   */
+  Node *takeAll() noexcept;
+
+  std::atomic<Node *> head_{nullptr};
+};
+
+} // namespace facebook::react
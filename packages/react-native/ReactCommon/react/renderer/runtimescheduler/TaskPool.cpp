@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TaskPool.h"
+
+#include <new>
+
+namespace facebook::react {
+
+TaskPool::TaskPool(size_t capacity)
+    : storage_(std::make_shared<Storage>(capacity)) {}
+
+size_t TaskPool::getNumberOfFreeBlocks() const {
+  std::lock_guard<std::mutex> lock(storage_->mutex);
+  return storage_->freeBlocks.size();
+}
+
+TaskPool::Storage::Storage(size_t capacity) : capacity(capacity) {
+  freeBlocks.reserve(capacity);
+}
+
+TaskPool::Storage::~Storage() {
+  for (auto block : freeBlocks) {
+    ::operator delete(block);
+  }
+}
+
+void *TaskPool::Storage::allocate(size_t size) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // All blocks requested by `std::allocate_shared<Task>` have the same size.
+    if (blockSize == 0) {
+      blockSize = size;
+    }
+
+    if (size == blockSize && !freeBlocks.empty()) {
+      auto block = freeBlocks.back();
+      freeBlocks.pop_back();
+      return block;
+    }
+  }
+
+  return ::operator new(size);
+}
+
+void TaskPool::Storage::deallocate(void *block, size_t size) noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (size == blockSize && freeBlocks.size() < capacity) {
+      freeBlocks.push_back(block);
+      return;
+    }
+  }
+
+  ::operator delete(block);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/Task.h>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Creates `Task` objects reusing memory of released ones: a task and the
+ * control block of its `std::shared_ptr` are allocated as a single block
+ * which returns to the pool (up to `capacity` blocks) once the last
+ * reference to the task is gone. Tasks can outlive the pool and can be
+ * released on any thread.
+ */
+class TaskPool final {
+ public:
+  explicit TaskPool(size_t capacity = 1024);
+
+  template <typename... ArgsT>
+  std::shared_ptr<Task> create(ArgsT &&...args) const {
+    return std::allocate_shared<Task>(
+        Allocator<Task>{storage_}, std::forward<ArgsT>(args)...);
+  }
+
+  /*
+   * Returns the number of blocks ready to be reused.
+   */
+  size_t getNumberOfFreeBlocks() const;
+
+ private:
+  struct Storage {
+    explicit Storage(size_t capacity);
+    ~Storage();
+
+    void *allocate(size_t size);
+    void deallocate(void *block, size_t size) noexcept;
+
+    size_t const capacity;
+    std::mutex mutex;
+    std::vector<void *> freeBlocks;
+    size_t blockSize{0};
+  };
+
+  template <typename T>
+  struct Allocator {
+    using value_type = T;
+
+    explicit Allocator(std::shared_ptr<Storage> storage)
+        : storage(std::move(storage)) {}
+
+    template <typename U>
+    Allocator(Allocator<U> const &other) : storage(other.storage) {}
+
+    T *allocate(size_t n) {
+      return static_cast<T *>(storage->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *pointer, size_t n) noexcept {
+      storage->deallocate(pointer, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(Allocator<U> const &rhs) const noexcept {
+      return storage == rhs.storage;
+    }
+
+    template <typename U>
+    bool operator!=(Allocator<U> const &rhs) const noexcept {
+      return storage != rhs.storage;
+    }
+
+    std::shared_ptr<Storage> storage;
+  };
+
+  std::shared_ptr<Storage> storage_;
+};
+
+} // namespace facebook::react
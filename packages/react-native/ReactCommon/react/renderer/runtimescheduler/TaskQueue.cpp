@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TaskQueue.h"
+
+#include <react/debug/react_native_assert.h>
+#include <algorithm>
+
+namespace facebook::react {
+
+bool TaskQueue::empty() const noexcept {
+  return tasks_.empty();
+}
+
+size_t TaskQueue::size() const noexcept {
+  return tasks_.size();
+}
+
+std::shared_ptr<Task> const &TaskQueue::top() const noexcept {
+  react_native_assert(!tasks_.empty());
+  return tasks_.front();
+}
+
+void TaskQueue::push(std::shared_ptr<Task> task) {
+  react_native_assert(task->queueIndex == Task::kNotQueued);
+  task->sequenceNumber = nextSequenceNumber_++;
+  tasks_.push_back(std::move(task));
+  tasks_.back()->queueIndex = tasks_.size() - 1;
+  siftUp(tasks_.size() - 1);
+}
+
+void TaskQueue::pop() {
+  remove(*top());
+}
+
+void TaskQueue::remove(Task &task) {
+  auto index = task.queueIndex;
+  if (index == Task::kNotQueued) {
+    return;
+  }
+
+  react_native_assert(index < tasks_.size() && tasks_[index].get() == &task);
+  task.queueIndex = Task::kNotQueued;
+
+  auto lastIndex = tasks_.size() - 1;
+  if (index == lastIndex) {
+    tasks_.pop_back();
+    return;
+  }
+
+  // The last task takes the place of the removed one (which may release it,
+  // so `task` must not be accessed afterwards).
+  place(index, std::move(tasks_[lastIndex]));
+  tasks_.pop_back();
+
+  if (!siftUp(index)) {
+    siftDown(index);
+  }
+}
+
+bool TaskQueue::isBefore(Task const &lhs, Task const &rhs) noexcept {
+  if (lhs.expirationTime != rhs.expirationTime) {
+    return lhs.expirationTime < rhs.expirationTime;
+  }
+  return lhs.sequenceNumber < rhs.sequenceNumber;
+}
+
+bool TaskQueue::siftUp(size_t index) {
+  auto initialIndex = index;
+  auto task = std::move(tasks_[index]);
+
+  while (index > 0) {
+    auto parentIndex = (index - 1) / kArity;
+    if (!isBefore(*task, *tasks_[parentIndex])) {
+      break;
+    }
+    place(index, std::move(tasks_[parentIndex]));
+    index = parentIndex;
+  }
+
+  place(index, std::move(task));
+  return index != initialIndex;
+}
+
+void TaskQueue::siftDown(size_t index) {
+  auto task = std::move(tasks_[index]);
+  auto size = tasks_.size();
+
+  while (true) {
+    auto firstChildIndex = index * kArity + 1;
+    if (firstChildIndex >= size) {
+      break;
+    }
+
+    auto lastChildIndex = std::min(firstChildIndex + kArity, size);
+    auto bestChildIndex = firstChildIndex;
+    for (auto childIndex = firstChildIndex + 1; childIndex < lastChildIndex;
+         childIndex++) {
+      if (isBefore(*tasks_[childIndex], *tasks_[bestChildIndex])) {
+        bestChildIndex = childIndex;
+      }
+    }
+
+    if (!isBefore(*tasks_[bestChildIndex], *task)) {
+      break;
+    }
+
+    place(index, std::move(tasks_[bestChildIndex]));
+    index = bestChildIndex;
+  }
+
+  place(index, std::move(task));
+}
+
+void TaskQueue::place(size_t index, std::shared_ptr<Task> task) {
+  task->queueIndex = index;
+  tasks_[index] = std::move(task);
+}
+
+} // namespace facebook::react
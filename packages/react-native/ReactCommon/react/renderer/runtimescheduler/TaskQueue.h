@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/Task.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Priority queue of tasks ordered by expiration time (and by the order of
+ * insertion for tasks which expire at the same time), implemented as an
+ * indexed 4-ary min-heap. Every queued task knows its position in the heap,
+ * so any task (e.g. a cancelled one) can be removed in O(log n) instead of
+ * waiting until it reaches the top.
+ *
+ * Thread synchronization must be enforced externally.
+ */
+class TaskQueue final {
+ public:
+  bool empty() const noexcept;
+  size_t size() const noexcept;
+
+  /*
+   * Returns the task which expires first. The queue must not be empty.
+   */
+  std::shared_ptr<Task> const &top() const noexcept;
+
+  void push(std::shared_ptr<Task> task);
+
+  /*
+   * Removes the task returned by `top`.
+   */
+  void pop();
+
+  /*
+   * Removes the task from the queue. Does nothing if the task isn't queued.
+   */
+  void remove(Task &task);
+
+ private:
+  static constexpr size_t kArity = 4;
+
+  static bool isBefore(Task const &lhs, Task const &rhs) noexcept;
+
+  /*
+   * Moves the task at the given index towards the root or the leaves until
+   * the heap property is restored.
+   */
+  bool siftUp(size_t index);
+  void siftDown(size_t index);
+
+  void place(size_t index, std::shared_ptr<Task> task);
+
+  std::vector<std::shared_ptr<Task>> tasks_;
+  uint64_t nextSequenceNumber_{0};
+};
+
+} // namespace facebook::react
@@ -10,6 +10,8 @@
 #include <jsi/jsi.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "StubClock.h"
 #include "StubErrorUtils.h"
@@ -243,6 +245,52 @@ TEST_F(RuntimeSchedulerTest, cancelTask) {
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_F(RuntimeSchedulerTest, cancelManyTasks) {
+  auto numberOfRunTasks = 0;
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+
+  for (int i = 0; i < 1000; i++) {
+    tasks.push_back(runtimeScheduler_->scheduleTask(
+        i % 2 == 0 ? SchedulerPriority::NormalPriority
+                   : SchedulerPriority::LowPriority,
+        [&](jsi::Runtime & /*unused*/) { numberOfRunTasks++; }));
+  }
+
+  // Cancelling every task except the last one, including one which is
+  // cancelled twice.
+  for (size_t i = 0; i < tasks.size() - 1; i++) {
+    runtimeScheduler_->cancelTask(*tasks[i]);
+  }
+  runtimeScheduler_->cancelTask(*tasks[0]);
+
+  // Cancelled tasks are released by the scheduler right away.
+  EXPECT_EQ(tasks[0].use_count(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(numberOfRunTasks, 1);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, cancelTaskFromAnotherTask) {
+  bool didRunCancelledTask = false;
+
+  auto cancelledTask = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::LowPriority,
+      [&](jsi::Runtime & /*unused*/) { didRunCancelledTask = true; });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [&](jsi::Runtime & /*unused*/) {
+        runtimeScheduler_->cancelTask(*cancelledTask);
+      });
+
+  stubQueue_->tick();
+
+  EXPECT_FALSE(didRunCancelledTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
 TEST_F(RuntimeSchedulerTest, continuationTask) {
   bool didRunTask = false;
   bool didContinuationTask = false;
@@ -275,6 +323,35 @@ TEST_F(RuntimeSchedulerTest, continuationTask) {
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_F(RuntimeSchedulerTest, continuationOfTaskCancelledWhileRunning) {
+  bool didContinuationTask = false;
+  auto task = std::shared_ptr<Task>{};
+
+  auto callback = createHostFunctionFromLambda([&](bool /*unused*/) {
+    runtimeScheduler_->cancelTask(*task);
+    return jsi::Function::createFromHostFunction(
+        *runtime_,
+        jsi::PropNameID::forUtf8(*runtime_, ""),
+        1,
+        [&](jsi::Runtime & /*runtime*/,
+            jsi::Value const & /*unused*/,
+            jsi::Value const * /*arguments*/,
+            size_t /*unused*/) noexcept -> jsi::Value {
+          didContinuationTask = true;
+          return jsi::Value::undefined();
+        });
+  });
+
+  task = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback));
+
+  stubQueue_->tick();
+
+  // The continuation takes the place of the cancelled callback.
+  EXPECT_TRUE(didContinuationTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
 TEST_F(RuntimeSchedulerTest, getCurrentPriorityLevel) {
   auto callback =
       createHostFunctionFromLambda([this](bool /*didUserCallbackTimeout*/) {
@@ -617,4 +694,323 @@ TEST_F(RuntimeSchedulerTest, twoThreadsRequestAccessToTheRuntime) {
   EXPECT_FALSE(runtimeScheduler_->getShouldYield());
 }
 
+TEST_F(RuntimeSchedulerTest, normalTasksYieldWhenTimeSliceIsUsedUp) {
+  bool didRunFirstTask = false;
+  bool didRunSecondTask = false;
+
+  auto firstCallback = createHostFunctionFromLambda([&](bool /*unused*/) {
+    didRunFirstTask = true;
+    stubClock_->advanceTimeBy(6ms);
+    EXPECT_TRUE(runtimeScheduler_->getShouldYield());
+    return jsi::Value::undefined();
+  });
+
+  auto secondCallback = createHostFunctionFromLambda([&](bool /*unused*/) {
+    didRunSecondTask = true;
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(firstCallback));
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(secondCallback));
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunFirstTask);
+  EXPECT_FALSE(didRunSecondTask);
+  // The work loop was scheduled again for the remaining task.
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunSecondTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, normalTasksYieldBeforeNextFrame) {
+  bool didRunFirstTask = false;
+  bool didRunSecondTask = false;
+
+  runtimeScheduler_->setTimeSlice(100ms);
+
+  // The next frame is expected to start at 16ms.
+  stubClock_->setTimePoint(0ms);
+  runtimeScheduler_->onFrame(RuntimeSchedulerTimePoint(0ms));
+  runtimeScheduler_->onFrame(RuntimeSchedulerTimePoint(8ms));
+
+  auto firstCallback = createHostFunctionFromLambda([&](bool /*unused*/) {
+    didRunFirstTask = true;
+    stubClock_->advanceTimeBy(10ms);
+    return jsi::Value::undefined();
+  });
+
+  auto secondCallback = createHostFunctionFromLambda([&](bool /*unused*/) {
+    didRunSecondTask = true;
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(firstCallback));
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(secondCallback));
+
+  stubClock_->setTimePoint(10ms);
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunFirstTask);
+  EXPECT_FALSE(didRunSecondTask);
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunSecondTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, expiredTasksDontYieldWhenTimeSliceIsUsedUp) {
+  auto numberOfRunTasks = 0;
+
+  for (int i = 0; i < 3; i++) {
+    runtimeScheduler_->scheduleTask(
+        SchedulerPriority::ImmediatePriority,
+        createHostFunctionFromLambda([&](bool /*unused*/) {
+          numberOfRunTasks++;
+          stubClock_->advanceTimeBy(10ms);
+          return jsi::Value::undefined();
+        }));
+  }
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(numberOfRunTasks, 3);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, queueingLatencyAndExecutionTimeHistograms) {
+  auto callback = createHostFunctionFromLambda([this](bool /*unused*/) {
+    stubClock_->advanceTimeBy(3ms);
+    return jsi::Value::undefined();
+  });
+
+  auto cancelledTask = runtimeScheduler_->scheduleTask(
+      SchedulerPriority::UserBlockingPriority,
+      createHostFunctionFromLambda(
+          [](bool /*unused*/) { return jsi::Value::undefined(); }));
+  runtimeScheduler_->cancelTask(*cancelledTask);
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback));
+
+  stubClock_->advanceTimeBy(2ms);
+  stubQueue_->tick();
+
+  auto const &queueingLatencyHistogram =
+      runtimeScheduler_->getQueueingLatencyHistogram(
+          SchedulerPriority::NormalPriority);
+  auto const &executionTimeHistogram =
+      runtimeScheduler_->getExecutionTimeHistogram(
+          SchedulerPriority::NormalPriority);
+
+  EXPECT_EQ(queueingLatencyHistogram.getCount(), 1);
+  EXPECT_EQ(queueingLatencyHistogram.getPercentile(0.5), 2048us);
+  EXPECT_EQ(executionTimeHistogram.getCount(), 1);
+  EXPECT_EQ(executionTimeHistogram.getPercentile(0.5), 4096us);
+
+  // Cancelled tasks are not recorded.
+  EXPECT_EQ(
+      runtimeScheduler_
+          ->getQueueingLatencyHistogram(SchedulerPriority::UserBlockingPriority)
+          .getCount(),
+      0);
+}
+
+TEST_F(RuntimeSchedulerTest, scheduleTasksFromAnyThread) {
+  auto const numberOfThreads = 4;
+  auto const numberOfTasksPerThread = 100;
+  auto numberOfExecutedTasks = 0;
+
+  auto threads = std::vector<std::thread>{};
+  for (int i = 0; i < numberOfThreads; i++) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < numberOfTasksPerThread; j++) {
+        runtimeScheduler_->scheduleTaskFromAnyThread(
+            SchedulerPriority::NormalPriority,
+            [&](jsi::Runtime & /*unused*/) { numberOfExecutedTasks++; });
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // Only a single work loop is scheduled for all of them.
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->flush();
+
+  EXPECT_EQ(numberOfExecutedTasks, numberOfThreads * numberOfTasksPerThread);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, tasksFromAnyThreadAreExecutedByPriority) {
+  auto executionOrder = std::vector<int>{};
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [&](jsi::Runtime & /*unused*/) { executionOrder.push_back(1); });
+
+  auto cancelledTask = std::shared_ptr<Task>{};
+  std::thread([&]() {
+    runtimeScheduler_->scheduleTaskFromAnyThread(
+        SchedulerPriority::UserBlockingPriority,
+        [&](jsi::Runtime & /*unused*/) { executionOrder.push_back(2); });
+    cancelledTask = runtimeScheduler_->scheduleTaskFromAnyThread(
+        SchedulerPriority::ImmediatePriority,
+        [&](jsi::Runtime & /*unused*/) { executionOrder.push_back(3); });
+  }).join();
+
+  // Cancelled before it was moved to the priority queue.
+  runtimeScheduler_->cancelTask(*cancelledTask);
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(executionOrder, (std::vector<int>{2, 1}));
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, idleTasksAreExecutedWhenThereIsNoOtherWork) {
+  auto executionOrder = std::vector<int>{};
+  auto idleTimeRemaining = RuntimeSchedulerDuration{};
+
+  runtimeScheduler_->scheduleIdleTask([&](jsi::Runtime & /*unused*/) {
+    executionOrder.push_back(2);
+    idleTimeRemaining = runtimeScheduler_->getIdleTimeRemaining();
+  });
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::LowPriority,
+      [&](jsi::Runtime & /*unused*/) { executionOrder.push_back(1); });
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  // Without frames, idle periods last 50ms.
+  EXPECT_EQ(executionOrder, (std::vector<int>{1, 2}));
+  EXPECT_EQ(idleTimeRemaining, 50ms);
+  EXPECT_EQ(runtimeScheduler_->getIdleTimeRemaining(), 0ms);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, idleTasksAreExecutedUntilNextFrame) {
+  auto numberOfExecutedIdleTasks = 0;
+  auto idleTimeRemaining = RuntimeSchedulerDuration{};
+
+  runtimeScheduler_->onFrame(stubClock_->getNow());
+
+  for (int i = 0; i < 3; i++) {
+    runtimeScheduler_->scheduleIdleTask([&](jsi::Runtime & /*unused*/) {
+      if (numberOfExecutedIdleTasks++ == 0) {
+        idleTimeRemaining = runtimeScheduler_->getIdleTimeRemaining();
+      }
+      stubClock_->advanceTimeBy(10ms);
+    });
+  }
+
+  stubQueue_->tick();
+
+  // The idle period ends when the next frame is expected.
+  EXPECT_EQ(numberOfExecutedIdleTasks, 2);
+  EXPECT_EQ(idleTimeRemaining, 16667us);
+  EXPECT_EQ(stubQueue_->size(), 0);
+
+  // The next frame starts another idle period.
+  runtimeScheduler_->onFrame(stubClock_->getNow());
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(numberOfExecutedIdleTasks, 3);
+
+  // No more idle tasks to execute.
+  runtimeScheduler_->onFrame(stubClock_->getNow() + 16ms);
+
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, idleTasksAreExecutedOnceTheirTimeoutElapses) {
+  auto didRunIdleTaskWithTimeout = false;
+  auto didRunIdleTask = false;
+
+  runtimeScheduler_->onFrame(stubClock_->getNow());
+  stubClock_->advanceTimeBy(20ms);
+
+  runtimeScheduler_->scheduleIdleTask(
+      [&](jsi::Runtime & /*unused*/) { didRunIdleTask = true; });
+  runtimeScheduler_->scheduleIdleTask(
+      [&](jsi::Runtime & /*unused*/) { didRunIdleTaskWithTimeout = true; },
+      5ms);
+
+  stubQueue_->tick();
+
+  // The next frame is overdue, there is no idle time.
+  EXPECT_FALSE(didRunIdleTaskWithTimeout);
+  EXPECT_FALSE(didRunIdleTask);
+
+  stubClock_->advanceTimeBy(10ms);
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, [](jsi::Runtime & /*unused*/) {});
+
+  stubQueue_->tick();
+
+  EXPECT_TRUE(didRunIdleTaskWithTimeout);
+  EXPECT_FALSE(didRunIdleTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, cancelIdleTask) {
+  auto didRunIdleTask = false;
+
+  auto idleTask = runtimeScheduler_->scheduleIdleTask(
+      [&](jsi::Runtime & /*unused*/) { didRunIdleTask = true; });
+  runtimeScheduler_->cancelTask(*idleTask);
+
+  stubQueue_->tick();
+
+  EXPECT_FALSE(didRunIdleTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(RuntimeSchedulerTest, javaScriptIdleTasksReceiveIdleDeadline) {
+  auto didTimeout = true;
+  auto timeRemaining = 0.0;
+
+  auto callback = jsi::Function::createFromHostFunction(
+      *runtime_,
+      jsi::PropNameID::forUtf8(*runtime_, ""),
+      1,
+      [&](jsi::Runtime &runtime,
+          jsi::Value const & /*unused*/,
+          jsi::Value const *arguments,
+          size_t /*unused*/) -> jsi::Value {
+        auto idleDeadline = arguments[0].getObject(runtime);
+        didTimeout = idleDeadline.getProperty(runtime, "didTimeout").getBool();
+        timeRemaining =
+            idleDeadline.getPropertyAsFunction(runtime, "timeRemaining")
+                .call(runtime)
+                .getNumber();
+        return jsi::Value::undefined();
+      });
+
+  runtimeScheduler_->scheduleIdleTask(std::move(callback));
+
+  stubQueue_->tick();
+
+  EXPECT_FALSE(didTimeout);
+  EXPECT_EQ(timeRemaining, 50.0);
+}
+
 } // namespace facebook::react
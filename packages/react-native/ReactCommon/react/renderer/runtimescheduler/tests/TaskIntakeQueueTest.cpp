@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/runtimescheduler/TaskIntakeQueue.h>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace facebook::react;
+
+static std::shared_ptr<Task> createTask() {
+  return std::make_shared<Task>(
+      SchedulerPriority::NormalPriority,
+      RawCallback{[](facebook::jsi::Runtime & /*runtime*/) {}},
+      RuntimeSchedulerTimePoint{});
+}
+
+TEST(TaskIntakeQueueTest, tasksAreDrainedInOrderOfPushing) {
+  auto queue = TaskIntakeQueue{};
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  for (int i = 0; i < 10; i++) {
+    tasks.push_back(createTask());
+    queue.push(tasks.back());
+  }
+
+  EXPECT_FALSE(queue.empty());
+
+  auto drainedTasks = std::vector<std::shared_ptr<Task>>{};
+  queue.drain([&](std::shared_ptr<Task> task) {
+    drainedTasks.push_back(std::move(task));
+  });
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(drainedTasks, tasks);
+}
+
+TEST(TaskIntakeQueueTest, remainingTasksAreReleasedWithTheQueue) {
+  auto task = createTask();
+  {
+    auto queue = TaskIntakeQueue{};
+    queue.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+/*
+ * Several producers push tasks while the consumer keeps draining them. Every
+ * task must be received exactly once, and tasks of every producer must be
+ * received in order.
+ */
+TEST(TaskIntakeQueueTest, concurrentProducers) {
+  auto const numberOfProducers = 4;
+  auto const numberOfTasksPerProducer = 20'000;
+
+  auto queue = TaskIntakeQueue{};
+  auto tasks = std::vector<std::vector<std::shared_ptr<Task>>>{};
+  for (int producer = 0; producer < numberOfProducers; producer++) {
+    tasks.emplace_back();
+    for (int i = 0; i < numberOfTasksPerProducer; i++) {
+      tasks.back().push_back(createTask());
+    }
+  }
+
+  auto numberOfFinishedProducers = std::atomic<int>{0};
+  auto producers = std::vector<std::thread>{};
+  for (int producer = 0; producer < numberOfProducers; producer++) {
+    producers.emplace_back([&, producer]() {
+      for (auto const &task : tasks[producer]) {
+        queue.push(task);
+      }
+      numberOfFinishedProducers++;
+    });
+  }
+
+  // The producer and the position of every task within the producer's tasks.
+  auto origins = std::unordered_map<Task const *, std::pair<int, int>>{};
+  for (int producer = 0; producer < numberOfProducers; producer++) {
+    for (int i = 0; i < numberOfTasksPerProducer; i++) {
+      origins[tasks[producer][i].get()] = {producer, i};
+    }
+  }
+
+  auto expectedIndices = std::vector<int>(numberOfProducers, 0);
+  auto numberOfReceivedTasks = 0;
+  auto consume = [&](std::shared_ptr<Task> task) {
+    auto [producer, index] = origins.at(task.get());
+    EXPECT_EQ(index, expectedIndices[producer]);
+    expectedIndices[producer]++;
+    numberOfReceivedTasks++;
+  };
+
+  while (numberOfFinishedProducers.load() < numberOfProducers) {
+    queue.drain(consume);
+  }
+  queue.drain(consume);
+
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  EXPECT_EQ(numberOfReceivedTasks, numberOfProducers * numberOfTasksPerProducer);
+  EXPECT_TRUE(queue.empty());
+}
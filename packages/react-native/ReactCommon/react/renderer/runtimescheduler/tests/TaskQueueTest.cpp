@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/runtimescheduler/TaskPool.h>
+#include <react/renderer/runtimescheduler/TaskQueue.h>
+#include <chrono>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace facebook::react;
+using namespace std::chrono_literals;
+
+static std::shared_ptr<Task> createTask(RuntimeSchedulerDuration expiration) {
+  return std::make_shared<Task>(
+      SchedulerPriority::NormalPriority,
+      RawCallback{[](facebook::jsi::Runtime & /*runtime*/) {}},
+      RuntimeSchedulerTimePoint(expiration));
+}
+
+TEST(TaskQueueTest, tasksAreOrderedByExpirationTime) {
+  auto queue = TaskQueue{};
+  auto task1 = createTask(30ms);
+  auto task2 = createTask(10ms);
+  auto task3 = createTask(20ms);
+
+  queue.push(task1);
+  queue.push(task2);
+  queue.push(task3);
+
+  EXPECT_EQ(queue.size(), 3);
+  EXPECT_EQ(queue.top(), task2);
+  queue.pop();
+  EXPECT_EQ(queue.top(), task3);
+  queue.pop();
+  EXPECT_EQ(queue.top(), task1);
+  queue.pop();
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(TaskQueueTest, tasksWithSameExpirationTimeAreFirstInFirstOut) {
+  auto queue = TaskQueue{};
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  for (int i = 0; i < 20; i++) {
+    tasks.push_back(createTask(10ms));
+    queue.push(tasks.back());
+  }
+
+  for (auto const &task : tasks) {
+    EXPECT_EQ(queue.top(), task);
+    queue.pop();
+  }
+}
+
+TEST(TaskQueueTest, removedTasksAreGoneImmediately) {
+  auto queue = TaskQueue{};
+  auto task1 = createTask(10ms);
+  auto task2 = createTask(20ms);
+
+  queue.push(task1);
+  queue.push(task2);
+  queue.remove(*task1);
+
+  EXPECT_EQ(queue.size(), 1);
+  EXPECT_EQ(queue.top(), task2);
+  EXPECT_EQ(task1.use_count(), 1);
+
+  // Removing a task which isn't queued does nothing.
+  queue.remove(*task1);
+  EXPECT_EQ(queue.size(), 1);
+
+  // Removed task can be queued again.
+  queue.push(task1);
+  EXPECT_EQ(queue.top(), task1);
+}
+
+/*
+ * Compares the queue against a sorted map under a random mix of pushes, pops
+ * and removals of arbitrary tasks.
+ */
+TEST(TaskQueueTest, randomOperations) {
+  auto random = std::mt19937(42);
+  auto queue = TaskQueue{};
+  auto expected = std::map<std::pair<int, int>, std::shared_ptr<Task>>{};
+
+  for (int i = 0; i < 20'000; i++) {
+    auto operation = random() % 4;
+
+    if (operation <= 1 || expected.empty()) {
+      auto expiration = static_cast<int>(random() % 100);
+      auto task = createTask(std::chrono::milliseconds(expiration));
+      queue.push(task);
+      expected.emplace(std::make_pair(expiration, i), task);
+    } else if (operation == 2) {
+      EXPECT_EQ(queue.top(), expected.begin()->second);
+      queue.pop();
+      expected.erase(expected.begin());
+    } else {
+      auto iterator = expected.begin();
+      std::advance(iterator, random() % expected.size());
+      queue.remove(*iterator->second);
+      expected.erase(iterator);
+    }
+
+    ASSERT_EQ(queue.size(), expected.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(queue.top(), expected.begin()->second);
+    }
+  }
+}
+
+TEST(TaskQueueTest, poolReusesMemoryOfReleasedTasks) {
+  auto pool = TaskPool{2};
+
+  auto task1 = pool.create(
+      SchedulerPriority::NormalPriority,
+      RawCallback{[](facebook::jsi::Runtime & /*runtime*/) {}},
+      RuntimeSchedulerTimePoint(10ms));
+  auto task1Address = task1.get();
+  EXPECT_EQ(pool.getNumberOfFreeBlocks(), 0);
+
+  task1.reset();
+  EXPECT_EQ(pool.getNumberOfFreeBlocks(), 1);
+
+  auto task2 = pool.create(
+      SchedulerPriority::NormalPriority,
+      RawCallback{[](facebook::jsi::Runtime & /*runtime*/) {}},
+      RuntimeSchedulerTimePoint(10ms));
+  EXPECT_EQ(task2.get(), task1Address);
+  EXPECT_EQ(pool.getNumberOfFreeBlocks(), 0);
+}
+
+TEST(TaskQueueTest, pooledTasksCanOutliveThePool) {
+  auto task = std::shared_ptr<Task>{};
+  {
+    auto pool = TaskPool{};
+    task = pool.create(
+        SchedulerPriority::NormalPriority,
+        RawCallback{[](facebook::jsi::Runtime & /*runtime*/) {}},
+        RuntimeSchedulerTimePoint(10ms));
+  }
+  task.reset();
+}
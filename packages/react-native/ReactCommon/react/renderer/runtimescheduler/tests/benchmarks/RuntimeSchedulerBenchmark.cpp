@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace facebook::react {
+
+static SchedulerPriority const kPriorities[] = {
+    SchedulerPriority::UserBlockingPriority,
+    SchedulerPriority::NormalPriority,
+    SchedulerPriority::LowPriority,
+    SchedulerPriority::IdlePriority,
+};
+
+/*
+ * The work loop never runs; only scheduling and cancellation are measured.
+ */
+static RuntimeExecutor const kIdleRuntimeExecutor =
+    [](std::function<void(jsi::Runtime & runtime)> && /*callback*/) {};
+
+/*
+ * Schedules a batch of tasks and cancels all of them in random order, the way
+ * short-lived transitions are created and abandoned.
+ */
+static void scheduleAndCancelTasks(benchmark::State &state) {
+  auto numberOfTasks = static_cast<size_t>(state.range(0));
+  auto runtimeScheduler = RuntimeScheduler(kIdleRuntimeExecutor);
+  auto random = std::mt19937(42);
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  tasks.reserve(numberOfTasks);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < numberOfTasks; i++) {
+      tasks.push_back(runtimeScheduler.scheduleTask(
+          kPriorities[i % 4], [](jsi::Runtime & /*runtime*/) {}));
+    }
+
+    std::shuffle(tasks.begin(), tasks.end(), random);
+    for (auto const &task : tasks) {
+      runtimeScheduler.cancelTask(*task);
+    }
+    tasks.clear();
+  }
+
+  state.SetItemsProcessed(
+      static_cast<int64_t>(state.iterations() * numberOfTasks));
+}
+BENCHMARK(scheduleAndCancelTasks)->Arg(100)->Arg(1000)->Arg(10000);
+
+/*
+ * Keeps a queue of long-living tasks while most of the newly scheduled ones
+ * are cancelled shortly after, so the queue doesn't grow.
+ */
+static void scheduleTasksCancellingMostOfThem(benchmark::State &state) {
+  auto numberOfLivingTasks = static_cast<size_t>(state.range(0));
+  auto runtimeScheduler = RuntimeScheduler(kIdleRuntimeExecutor);
+  auto livingTasks = std::vector<std::shared_ptr<Task>>{};
+
+  for (size_t i = 0; i < numberOfLivingTasks; i++) {
+    livingTasks.push_back(runtimeScheduler.scheduleTask(
+        kPriorities[i % 4], [](jsi::Runtime & /*runtime*/) {}));
+  }
+
+  for (auto _ : state) {
+    for (int i = 0; i < 10; i++) {
+      auto task = runtimeScheduler.scheduleTask(
+          kPriorities[i % 4], [](jsi::Runtime & /*runtime*/) {});
+      runtimeScheduler.cancelTask(*task);
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 10));
+}
+BENCHMARK(scheduleTasksCancellingMostOfThem)->Arg(100)->Arg(10000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
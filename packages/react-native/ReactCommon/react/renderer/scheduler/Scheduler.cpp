@@ -131,6 +131,24 @@ Scheduler::Scheduler(
   CoreFeatures::blockPaintForUseLayoutEffect = reactNativeConfig_->getBool(
       "react_fabric:block_paint_for_use_layout_effect");
 
+  CoreFeatures::enableParallelDiffing =
+      reactNativeConfig_->getBool("react_fabric:enable_parallel_diffing");
+
+  CoreFeatures::enableSubtreeHashDiffing = reactNativeConfig_->getBool(
+      "react_fabric:enable_subtree_hash_diffing");
+
+  CoreFeatures::enableIncrementalLayout = reactNativeConfig_->getBool(
+      "react_fabric:enable_incremental_layout");
+
+  CoreFeatures::enableParallelLayout =
+      reactNativeConfig_->getBool("react_fabric:enable_parallel_layout");
+
+  CoreFeatures::enableSpeculativeDiffing =
+      reactNativeConfig_->getBool("react_fabric:enable_speculative_diffing");
+
+  CoreFeatures::enableCommitRebasing =
+      reactNativeConfig_->getBool("react_fabric:enable_commit_rebasing");
+
   if (animationDelegate != nullptr) {
     animationDelegate->setComponentDescriptorRegistry(
         componentDescriptorRegistry_);
@@ -205,7 +223,7 @@ void Scheduler::registerSurface(
 InspectorData Scheduler::getInspectorDataForInstance(
     EventEmitter const &eventEmitter) const noexcept {
   return executeSynchronouslyOnSameThread_CAN_DEADLOCK<InspectorData>(
-      runtimeExecutor_, [=](jsi::Runtime &runtime) -> InspectorData {
+      runtimeExecutor_, [&](jsi::Runtime &runtime) -> InspectorData {
         auto uiManagerBinding = UIManagerBinding::getBinding(runtime);
         auto value = uiManagerBinding->getInspectorDataForInstance(
             runtime, eventEmitter);
@@ -315,7 +333,8 @@ void Scheduler::uiManagerDidFinishTransaction(
           ? weakRuntimeScheduler.value().lock()
           : nullptr;
       if (runtimeScheduler && !mountSynchronously) {
-        runtimeScheduler->scheduleTask(
+        // Commits may happen on any thread.
+        runtimeScheduler->scheduleTaskFromAnyThread(
             SchedulerPriority::UserBlockingPriority,
             [delegate = delegate_,
              mountingCoordinator =
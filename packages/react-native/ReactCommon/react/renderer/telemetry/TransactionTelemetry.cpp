@@ -84,6 +84,10 @@ void TransactionTelemetry::didLayout() {
   layoutEndTime_ = now_();
 }
 
+void TransactionTelemetry::didVisitLayoutNodes(int numberOfNodes) {
+  numberOfLayoutVisitedNodes_ += numberOfNodes;
+}
+
 void TransactionTelemetry::willMount() {
   react_native_assert(mountStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(mountEndTime_ == kTelemetryUndefinedTimePoint);
@@ -96,10 +100,25 @@ void TransactionTelemetry::didMount() {
   mountEndTime_ = now_();
 }
 
+void TransactionTelemetry::didRebaseCommit() {
+  numberOfCommitRebases_++;
+}
+
 void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
 
+void TransactionTelemetry::setNumberOfDiffAllocations(
+    int numberOfAllocations,
+    int numberOfHeapAllocations) {
+  numberOfDiffAllocations_ = numberOfAllocations;
+  numberOfDiffHeapAllocations_ = numberOfHeapAllocations;
+}
+
+void TransactionTelemetry::setNumberOfCommitRetries(int numberOfRetries) {
+  numberOfCommitRetries_ = numberOfRetries;
+}
+
 TelemetryTimePoint TransactionTelemetry::getDiffStartTime() const {
   react_native_assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
@@ -160,4 +179,24 @@ int TransactionTelemetry::getRevisionNumber() const {
   return revisionNumber_;
 }
 
+int TransactionTelemetry::getNumberOfDiffAllocations() const {
+  return numberOfDiffAllocations_;
+}
+
+int TransactionTelemetry::getNumberOfDiffHeapAllocations() const {
+  return numberOfDiffHeapAllocations_;
+}
+
+int TransactionTelemetry::getNumberOfLayoutVisitedNodes() const {
+  return numberOfLayoutVisitedNodes_;
+}
+
+int TransactionTelemetry::getNumberOfCommitRetries() const {
+  return numberOfCommitRetries_;
+}
+
+int TransactionTelemetry::getNumberOfCommitRebases() const {
+  return numberOfCommitRebases_;
+}
+
 } // namespace facebook::react
@@ -44,10 +44,16 @@ class TransactionTelemetry final {
   void willMeasureText();
   void didMeasureText();
   void didLayout();
+  void didVisitLayoutNodes(int numberOfNodes);
   void willMount();
   void didMount();
+  void didRebaseCommit();
 
   void setRevisionNumber(int revisionNumber);
+  void setNumberOfDiffAllocations(
+      int numberOfAllocations,
+      int numberOfHeapAllocations);
+  void setNumberOfCommitRetries(int numberOfRetries);
 
   /*
    * Reading
@@ -65,6 +71,27 @@ class TransactionTelemetry final {
   int getNumberOfTextMeasurements() const;
   int getRevisionNumber() const;
 
+  /*
+   * Number of scratch allocations requested by the differ and number of
+   * allocations which actually reached the heap to serve them.
+   */
+  int getNumberOfDiffAllocations() const;
+  int getNumberOfDiffHeapAllocations() const;
+
+  /*
+   * Number of shadow nodes visited by layout passes during the transaction.
+   * Nodes outside of dirty paths (and their siblings) are not visited.
+   */
+  int getNumberOfLayoutVisitedNodes() const;
+
+  /*
+   * Number of times the transaction was run again because another commit
+   * happened in the meantime, and number of times its changes were rebased
+   * on top of such a commit instead.
+   */
+  int getNumberOfCommitRetries() const;
+  int getNumberOfCommitRebases() const;
+
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint diffEndTime_{kTelemetryUndefinedTimePoint};
@@ -80,6 +107,11 @@ class TransactionTelemetry final {
 
   int numberOfTextMeasurements_{0};
   int revisionNumber_{0};
+  int numberOfDiffAllocations_{0};
+  int numberOfDiffHeapAllocations_{0};
+  int numberOfLayoutVisitedNodes_{0};
+  int numberOfCommitRetries_{0};
+  int numberOfCommitRebases_{0};
   std::function<TelemetryTimePoint()> now_;
 };
 
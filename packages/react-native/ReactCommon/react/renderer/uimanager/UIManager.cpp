@@ -238,19 +238,19 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
   return shadowTree;
 }
 
-ShadowNode::Shared UIManager::getNewestCloneOfShadowNode(
-    ShadowNode const &shadowNode) const {
-  auto ancestorShadowNode = ShadowNode::Shared{};
-  shadowTreeRegistry_.visit(
-      shadowNode.getSurfaceId(), [&](ShadowTree const &shadowTree) {
-        ancestorShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
-      });
-
-  if (!ancestorShadowNode) {
+/*
+ * Returns the node of the same family as `shadowNode` from the given revision
+ * of a shadow tree, or `nullptr` if the revision does not contain such node.
+ */
+static ShadowNode::Shared getCloneOfShadowNodeInRevision(
+    ShadowNode const &shadowNode,
+    ShadowTreeRevision const &revision) {
+  if (!revision.rootShadowNode) {
     return nullptr;
   }
 
-  auto ancestors = shadowNode.getFamily().getAncestors(*ancestorShadowNode);
+  auto ancestors = shadowNode.getFamily().getAncestors(
+      *revision.rootShadowNode, revision.ancestorIndex.get());
 
   if (ancestors.empty()) {
     return nullptr;
@@ -260,11 +260,31 @@ ShadowNode::Shared UIManager::getNewestCloneOfShadowNode(
   return pair->first.get().getChildren().at(pair->second);
 }
 
+ShadowNode::Shared UIManager::getNewestCloneOfShadowNode(
+    ShadowNode const &shadowNode) const {
+  auto revision = ShadowTreeRevision{};
+  shadowTreeRegistry_.visit(
+      shadowNode.getSurfaceId(), [&](ShadowTree const &shadowTree) {
+        revision = shadowTree.getCurrentRevision();
+      });
+
+  return getCloneOfShadowNodeInRevision(shadowNode, revision);
+}
+
 ShadowNode::Shared UIManager::findNodeAtPoint(
     ShadowNode::Shared const &node,
     Point point) const {
+  auto revision = ShadowTreeRevision{};
+  shadowTreeRegistry_.visit(
+      node->getSurfaceId(), [&](ShadowTree const &shadowTree) {
+        revision = shadowTree.getCurrentRevision();
+      });
+
+  // The hit-test index must only be used with nodes of its own revision.
   return LayoutableShadowNode::findNodeAtPoint(
-      getNewestCloneOfShadowNode(*node), point);
+      getCloneOfShadowNodeInRevision(*node, revision),
+      point,
+      revision.hitTestIndex.get());
 }
 
 LayoutMetrics UIManager::getRelativeLayoutMetrics(
@@ -276,13 +296,15 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
   // We might store here an owning pointer to `ancestorShadowNode` to ensure
   // that the node is not deallocated during method execution lifetime.
   auto owningAncestorShadowNode = ShadowNode::Shared{};
+  auto ancestorIndex = std::shared_ptr<AncestorIndex const>{};
 
   if (ancestorShadowNode == nullptr) {
     shadowTreeRegistry_.visit(
         shadowNode.getSurfaceId(), [&](ShadowTree const &shadowTree) {
-          owningAncestorShadowNode =
-              shadowTree.getCurrentRevision().rootShadowNode;
+          auto revision = shadowTree.getCurrentRevision();
+          owningAncestorShadowNode = std::move(revision.rootShadowNode);
           ancestorShadowNode = owningAncestorShadowNode.get();
+          ancestorIndex = std::move(revision.ancestorIndex);
         });
   } else {
     // It is possible for JavaScript (or other callers) to have a reference
@@ -290,6 +312,13 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
     // metrics are only calculated on most recently committed versions.
     owningAncestorShadowNode = getNewestCloneOfShadowNode(*ancestorShadowNode);
     ancestorShadowNode = owningAncestorShadowNode.get();
+
+    // The index might belong to a newer revision if a commit happened in
+    // between; that is fine because the index validates its entries.
+    shadowTreeRegistry_.visit(
+        shadowNode.getSurfaceId(), [&](ShadowTree const &shadowTree) {
+          ancestorIndex = shadowTree.getCurrentRevision().ancestorIndex;
+        });
   }
 
   auto layoutableAncestorShadowNode =
@@ -300,7 +329,10 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
   }
 
   return LayoutableShadowNode::computeRelativeLayoutMetrics(
-      shadowNode.getFamily(), *layoutableAncestorShadowNode, policy);
+      shadowNode.getFamily(),
+      *layoutableAncestorShadowNode,
+      policy,
+      ancestorIndex.get());
 }
 
 void UIManager::updateState(StateUpdate const &stateUpdate) const {
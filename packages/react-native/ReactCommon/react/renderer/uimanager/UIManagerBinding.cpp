@@ -64,8 +64,7 @@ UIManagerBinding::~UIManagerBinding() {
 jsi::Value UIManagerBinding::getInspectorDataForInstance(
     jsi::Runtime &runtime,
     EventEmitter const &eventEmitter) const {
-  auto eventTarget = eventEmitter.eventTarget_;
-  EventEmitter::DispatchMutex().lock();
+  auto eventTarget = eventEmitter.getEventTarget();
 
   if (!runtime.global().hasProperty(runtime, "__fbBatchedBridge") ||
       !eventTarget) {
@@ -75,7 +74,6 @@ jsi::Value UIManagerBinding::getInspectorDataForInstance(
   eventTarget->retain(runtime);
   auto instanceHandle = eventTarget->getInstanceHandle(runtime);
   eventTarget->release(runtime);
-  EventEmitter::DispatchMutex().unlock();
 
   if (instanceHandle.isUndefined()) {
     return jsi::Value::undefined();
@@ -257,13 +255,11 @@ jsi::Value UIManagerBinding::get(
               arguments[3].getObject(runtime).getFunction(runtime);
           auto targetNode =
               uiManager->findNodeAtPoint(node, Point{locationX, locationY});
-          auto &eventTarget = targetNode->getEventEmitter()->eventTarget_;
+          auto eventTarget = targetNode->getEventEmitter()->getEventTarget();
 
-          EventEmitter::DispatchMutex().lock();
           eventTarget->retain(runtime);
           auto instanceHandle = eventTarget->getInstanceHandle(runtime);
           eventTarget->release(runtime);
-          EventEmitter::DispatchMutex().unlock();
 
           onSuccessFunction.call(runtime, std::move(instanceHandle));
           return jsi::Value::undefined();
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "WorkStealingPool.h"
+
+#include <map>
+
+namespace facebook {
+namespace yoga {
+namespace detail {
+
+namespace {
+
+// The pool (if any) the current thread is a worker of, and its index.
+thread_local const WorkStealingPool* currentPool = nullptr;
+thread_local size_t currentWorkerIndex = 0;
+
+} // namespace
+
+WorkStealingPool& WorkStealingPool::shared(size_t numberOfThreads) {
+  static std::mutex mutex;
+  // Intentionally leaked: worker threads must not be joined while static
+  // objects are being destroyed.
+  static auto pools =
+      new std::map<size_t, std::unique_ptr<WorkStealingPool>>();
+
+  auto numberOfWorkers = numberOfThreads > 1 ? numberOfThreads - 1 : 1;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& pool = (*pools)[numberOfWorkers];
+  if (!pool) {
+    pool = std::make_unique<WorkStealingPool>(numberOfWorkers);
+  }
+  return *pool;
+}
+
+WorkStealingPool::WorkStealingPool(size_t numberOfWorkers) {
+  queues_.reserve(numberOfWorkers + 1);
+  for (size_t i = 0; i < numberOfWorkers + 1; i++) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+
+  workers_.reserve(numberOfWorkers);
+  for (size_t i = 0; i < numberOfWorkers; i++) {
+    workers_.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    stopping_ = true;
+  }
+  sleepCondition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+size_t WorkStealingPool::currentQueueIndex() const {
+  return currentPool == this ? currentWorkerIndex : workers_.size();
+}
+
+void WorkStealingPool::spawn(Group& group, Task task) {
+  group.pendingTasks_.fetch_add(1, std::memory_order_relaxed);
+
+  auto& queue = *queues_[currentQueueIndex()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.entries.push_back({std::move(task), &group});
+  }
+
+  {
+    // Incrementing under the mutex guarantees that a worker which is about to
+    // fall asleep either sees the new task or receives the notification.
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    pendingTasks_.fetch_add(1, std::memory_order_relaxed);
+  }
+  sleepCondition_.notify_one();
+}
+
+bool WorkStealingPool::runPendingTask(size_t preferredQueueIndex) {
+  auto entry = Entry{};
+  auto found = false;
+
+  // Own tasks are taken from the back (the most recently spawned ones).
+  {
+    auto& queue = *queues_[preferredQueueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.entries.empty()) {
+      entry = std::move(queue.entries.back());
+      queue.entries.pop_back();
+      found = true;
+    }
+  }
+
+  // Tasks of other threads are stolen from the front (the oldest ones, which
+  // usually represent the biggest chunks of work).
+  for (size_t i = 1; !found && i < queues_.size(); i++) {
+    auto& queue = *queues_[(preferredQueueIndex + i) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.entries.empty()) {
+      entry = std::move(queue.entries.front());
+      queue.entries.pop_front();
+      found = true;
+    }
+  }
+
+  if (!found) {
+    return false;
+  }
+
+  pendingTasks_.fetch_sub(1, std::memory_order_relaxed);
+  entry.task();
+  entry.group->pendingTasks_.fetch_sub(1, std::memory_order_release);
+  return true;
+}
+
+void WorkStealingPool::wait(Group& group) {
+  auto queueIndex = currentQueueIndex();
+  while (group.pendingTasks_.load(std::memory_order_acquire) != 0) {
+    if (!runPendingTask(queueIndex)) {
+      // Remaining tasks of the group are being run by other threads.
+      std::this_thread::yield();
+    }
+  }
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+  currentPool = this;
+  currentWorkerIndex = index;
+
+  while (true) {
+    if (runPendingTask(index)) {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleepMutex_);
+    sleepCondition_.wait(lock, [this] {
+      return stopping_ || pendingTasks_.load(std::memory_order_relaxed) != 0;
+    });
+    if (stopping_) {
+      return;
+    }
+  }
+}
+
+} // namespace detail
+} // namespace yoga
+} // namespace facebook
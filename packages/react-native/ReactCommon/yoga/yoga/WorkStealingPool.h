@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace yoga {
+
+namespace detail {
+
+// A fixed-size pool of threads, each of them owning a queue of tasks. A thread
+// takes tasks from the back of its own queue and, once it runs out of them,
+// steals tasks from the front of the queues of other threads. Tasks spawned by
+// a task are pushed to the queue of the thread running it, so related work
+// tends to stay on the same thread.
+//
+// Tasks are spawned as a part of a `Group`; a thread waiting for a group to
+// finish runs pending tasks (of any group) instead of blocking, which makes it
+// safe to wait for a group from within a task.
+class WorkStealingPool {
+public:
+  using Task = std::function<void()>;
+
+  class Group {
+  public:
+    Group() = default;
+    Group(const Group&) = delete;
+    Group& operator=(const Group&) = delete;
+
+  private:
+    friend class WorkStealingPool;
+    std::atomic<size_t> pendingTasks_{0};
+  };
+
+  // Returns a process-wide pool which runs tasks on `numberOfThreads` threads
+  // (including a thread waiting for a group). Pools are created lazily and
+  // live until the process exits.
+  static WorkStealingPool& shared(size_t numberOfThreads);
+
+  explicit WorkStealingPool(size_t numberOfWorkers);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  // Schedules `task` to be run as a part of `group`. Can be called on any
+  // thread, including from within a task.
+  void spawn(Group& group, Task task);
+
+  // Returns once all tasks spawned as a part of `group` (including tasks
+  // spawned by these tasks) finished. The calling thread runs pending tasks
+  // while waiting.
+  void wait(Group& group);
+
+private:
+  struct Entry {
+    Task task;
+    Group* group;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Entry> entries;
+  };
+
+  void workerLoop(size_t index);
+  bool runPendingTask(size_t preferredQueueIndex);
+  size_t currentQueueIndex() const;
+
+  // One queue per worker plus one shared by all other threads.
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+
+  std::mutex sleepMutex_;
+  std::condition_variable sleepCondition_;
+  std::atomic<size_t> pendingTasks_{0};
+  bool stopping_{false};
+};
+
+} // namespace detail
+} // namespace yoga
+} // namespace facebook
+
+#endif
@@ -43,6 +43,8 @@ public:
   bool useLegacyStretchBehaviour = false;
   bool shouldDiffLayoutWithoutLegacyStretchBehaviour = false;
   bool printTree = false;
+  bool skipUnchangedSubtreesWhenRounding = false;
+  uint32_t parallelLayoutThreadCount = 0;
   float pointScaleFactor = 1.0f;
   std::array<bool, facebook::yoga::enums::count<YGExperimentalFeature>()>
       experimentalFeatures = {};
@@ -24,6 +24,9 @@ private:
   static constexpr size_t directionOffset = 0;
   static constexpr size_t hadOverflowOffset =
       directionOffset + facebook::yoga::detail::bitWidthFn<YGDirection>();
+  static constexpr size_t hadCachedLayoutOffset = hadOverflowOffset + 1;
+  static constexpr size_t hasPendingLayoutOffset = hadCachedLayoutOffset + 1;
+  static constexpr size_t hadStableRoundingOffset = hasPendingLayoutOffset + 1;
   uint8_t flags = 0;
 
 public:
@@ -35,13 +38,22 @@ public:
   uint32_t generationCount = 0;
   YGDirection lastOwnerDirection = YGDirectionInherit;
 
-  uint32_t nextCachedMeasurementsIndex = 0;
-  std::array<YGCachedMeasurement, YG_MAX_CACHED_RESULT_COUNT>
-      cachedMeasurements = {};
+  // Absolute position of the owner of the node at the time the node was last
+  // rounded to the pixel grid.
+  std::array<double, 2> lastRoundingOwnerPosition = {
+      {YGUndefined, YGUndefined}};
+
+  // Fields read for every child by a layout pass over its owner are kept
+  // together, ahead of the (much bigger and rarely fully read) measurement
+  // cache, so that they share as few cache lines as possible.
   std::array<float, 2> measuredDimensions = {{YGUndefined, YGUndefined}};
 
   YGCachedMeasurement cachedLayout = YGCachedMeasurement();
 
+  uint32_t nextCachedMeasurementsIndex = 0;
+  std::array<YGCachedMeasurement, YG_MAX_CACHED_RESULT_COUNT>
+      cachedMeasurements = {};
+
   YGDirection direction() const {
     return facebook::yoga::detail::getEnumData<YGDirection>(
         flags, directionOffset);
@@ -60,6 +72,39 @@ public:
         flags, hadOverflowOffset, hadOverflow);
   }
 
+  // Whether the last layout of the node was served from the cache, in which
+  // case none of the descendants of the node were visited.
+  bool hadCachedLayout() const {
+    return facebook::yoga::detail::getBooleanData(flags, hadCachedLayoutOffset);
+  }
+  void setHadCachedLayout(bool hadCachedLayout) {
+    facebook::yoga::detail::setBooleanData(
+        flags, hadCachedLayoutOffset, hadCachedLayout);
+  }
+
+  // Whether the layout of the node was postponed by a parallel layout pass
+  // and has not been performed yet.
+  bool hasPendingLayout() const {
+    return facebook::yoga::detail::getBooleanData(
+        flags, hasPendingLayoutOffset);
+  }
+  void setHasPendingLayout(bool hasPendingLayout) {
+    facebook::yoga::detail::setBooleanData(
+        flags, hasPendingLayoutOffset, hasPendingLayout);
+  }
+
+  // Whether the last rounding to the pixel grid did not change any value in
+  // the subtree of the node, i.e. rounding it again from the same owner
+  // position (`lastRoundingOwnerPosition`) would not change anything either.
+  bool hadStableRounding() const {
+    return facebook::yoga::detail::getBooleanData(
+        flags, hadStableRoundingOffset);
+  }
+  void setHadStableRounding(bool hadStableRounding) {
+    facebook::yoga::detail::setBooleanData(
+        flags, hadStableRoundingOffset, hadStableRounding);
+  }
+
   bool operator==(YGLayout layout) const;
   bool operator!=(YGLayout layout) const { return !(*this == layout); }
 };
@@ -11,9 +11,13 @@
 #include <string.h>
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "Utils.h"
 #include "YGNode.h"
+#include "WorkStealingPool.h"
 #include "YGNodePrint.h"
 #include "Yoga-internal.h"
 #include "event/event.h"
@@ -30,6 +34,7 @@ __forceinline const float fmaxf(const float a, const float b) {
 
 using namespace facebook::yoga;
 using detail::Log;
+using detail::WorkStealingPool;
 
 #ifdef ANDROID
 static int YGAndroidLog(
@@ -972,6 +977,8 @@ bool YGLayoutNodeInternal(
     const uint32_t depth,
     const uint32_t generationCount);
 
+static void YGPerformPendingLayout(const YGNodeRef node);
+
 #ifdef DEBUG
 static void YGNodePrintInternal(
     const YGNodeRef node,
@@ -1024,6 +1031,11 @@ static inline YGAlign YGNodeAlignItem(const YGNode* node, const YGNode* child) {
 }
 
 static float YGBaseline(const YGNodeRef node, void* layoutContext) {
+  if (node->getLayout().hasPendingLayout()) {
+    // The baseline depends on the layout of descendants.
+    YGPerformPendingLayout(node);
+  }
+
   if (node->hasBaselineFunc()) {
 
     Event::publish<Event::NodeBaselineStart>(node);
@@ -3791,6 +3803,132 @@ YOGA_EXPORT bool YGNodeCanUseCachedMeasurement(
   return widthIsCompatible && heightIsCompatible;
 }
 
+// Layout of a node which was postponed by a pass running in the parallel mode
+// (see `YGConfigSetParallelLayoutThreadCount`).
+struct YGDeferredLayout {
+  YGNodeRef node;
+  float availableWidth;
+  float availableHeight;
+  YGDirection ownerDirection;
+  float ownerWidth;
+  float ownerHeight;
+  YGConfigRef config;
+  void* layoutContext;
+  uint32_t depth;
+  uint32_t generationCount;
+  LayoutPassReason reason;
+  bool isPending;
+};
+
+// Layouts deferred by the serial part of a layout pass (or of a deferred
+// layout) running on this thread.
+struct YGDeferredLayouts {
+  std::vector<YGDeferredLayout> layouts;
+  LayoutData* layoutMarkerData;
+  // The node whose layout deferred the layouts.
+  YGNodeRef root;
+};
+
+// `nullptr` unless the current thread runs a pass in the parallel mode.
+static thread_local YGDeferredLayouts* gDeferredLayouts = nullptr;
+
+// The layout of a node whose both dimensions are exactly defined does not
+// affect its siblings and ancestors beyond its measured dimensions (which are
+// known upfront), so it can be postponed and performed concurrently with other
+// such layouts.
+static inline bool YGCanDeferLayout(
+    const YGNodeRef node,
+    const bool performLayout,
+    const YGMeasureMode widthMeasureMode,
+    const YGMeasureMode heightMeasureMode,
+    const uint32_t depth) {
+  return gDeferredLayouts != nullptr && performLayout && depth > 1 &&
+      widthMeasureMode == YGMeasureModeExactly &&
+      heightMeasureMode == YGMeasureModeExactly && !node->hasMeasureFunc() &&
+      !node->getChildren().empty();
+}
+
+static void YGDeferLayout(
+    const YGNodeRef node,
+    const float availableWidth,
+    const float availableHeight,
+    const YGDirection ownerDirection,
+    const YGMeasureMode widthMeasureMode,
+    const YGMeasureMode heightMeasureMode,
+    const float ownerWidth,
+    const float ownerHeight,
+    const YGConfigRef config,
+    void* const layoutContext,
+    const uint32_t depth,
+    const uint32_t generationCount,
+    const LayoutPassReason reason) {
+  // For exactly defined dimensions, these are the same measured dimensions
+  // `YGNodelayoutImpl` computes.
+  YGNodeFixedSizeSetMeasuredDimensions(
+      node,
+      availableWidth -
+          node->getMarginForAxis(YGFlexDirectionRow, ownerWidth).unwrap(),
+      availableHeight -
+          node->getMarginForAxis(YGFlexDirectionColumn, ownerWidth).unwrap(),
+      widthMeasureMode,
+      heightMeasureMode,
+      ownerWidth,
+      ownerHeight);
+
+  node->getLayout().setHasPendingLayout(true);
+  gDeferredLayouts->layouts.push_back(
+      {node,
+       availableWidth,
+       availableHeight,
+       ownerDirection,
+       ownerWidth,
+       ownerHeight,
+       config,
+       layoutContext,
+       depth,
+       generationCount,
+       reason,
+       true});
+}
+
+static void YGPerformDeferredLayout(
+    const YGDeferredLayout& deferredLayout,
+    LayoutData& layoutMarkerData) {
+  YGNodelayoutImpl(
+      deferredLayout.node,
+      deferredLayout.availableWidth,
+      deferredLayout.availableHeight,
+      deferredLayout.ownerDirection,
+      YGMeasureModeExactly,
+      YGMeasureModeExactly,
+      deferredLayout.ownerWidth,
+      deferredLayout.ownerHeight,
+      true,
+      deferredLayout.config,
+      layoutMarkerData,
+      deferredLayout.layoutContext,
+      deferredLayout.depth,
+      deferredLayout.generationCount,
+      deferredLayout.reason);
+}
+
+// Performs the deferred layout of the node right away, on the current thread.
+// Used when the serial part of the pass turns out to depend on it.
+static void YGPerformPendingLayout(const YGNodeRef node) {
+  auto& layouts = gDeferredLayouts->layouts;
+  for (size_t i = layouts.size(); i > 0; i--) {
+    if (layouts[i - 1].node == node && layouts[i - 1].isPending) {
+      layouts[i - 1].isPending = false;
+      node->getLayout().setHasPendingLayout(false);
+      // Copied, as `layouts` may grow during the layout.
+      const auto deferredLayout = layouts[i - 1];
+      YGPerformDeferredLayout(
+          deferredLayout, *gDeferredLayouts->layoutMarkerData);
+      return;
+    }
+  }
+}
+
 //
 // This is a wrapper around the YGNodelayoutImpl function. It determines whether
 // the layout request is redundant and can be skipped.
@@ -3817,6 +3955,12 @@ bool YGLayoutNodeInternal(
     const uint32_t generationCount) {
   YGLayout* layout = &node->getLayout();
 
+  if (layout->hasPendingLayout()) {
+    // The node is being laid out again within the same pass, so the results of
+    // the deferred layout can be required.
+    YGPerformPendingLayout(node);
+  }
+
   depth++;
 
   const bool needToVisitNode =
@@ -3963,22 +4107,40 @@ bool YGLayoutNodeInternal(
           LayoutPassReasonToString(reason));
     }
 
-    YGNodelayoutImpl(
-        node,
-        availableWidth,
-        availableHeight,
-        ownerDirection,
-        widthMeasureMode,
-        heightMeasureMode,
-        ownerWidth,
-        ownerHeight,
-        performLayout,
-        config,
-        layoutMarkerData,
-        layoutContext,
-        depth,
-        generationCount,
-        reason);
+    if (YGCanDeferLayout(
+            node, performLayout, widthMeasureMode, heightMeasureMode, depth)) {
+      YGDeferLayout(
+          node,
+          availableWidth,
+          availableHeight,
+          ownerDirection,
+          widthMeasureMode,
+          heightMeasureMode,
+          ownerWidth,
+          ownerHeight,
+          config,
+          layoutContext,
+          depth,
+          generationCount,
+          reason);
+    } else {
+      YGNodelayoutImpl(
+          node,
+          availableWidth,
+          availableHeight,
+          ownerDirection,
+          widthMeasureMode,
+          heightMeasureMode,
+          ownerWidth,
+          ownerHeight,
+          performLayout,
+          config,
+          layoutMarkerData,
+          layoutContext,
+          depth,
+          generationCount,
+          reason);
+    }
 
     if (gPrintChanges) {
       Log::log(
@@ -4049,6 +4211,7 @@ bool YGLayoutNodeInternal(
 
     node->setHasNewLayout(true);
     node->setDirty(false);
+    layout->setHadCachedLayout(!needToVisitNode && cachedResults != nullptr);
   }
 
   layout->generationCount = generationCount;
@@ -4084,13 +4247,54 @@ YOGA_EXPORT void YGConfigSetPointScaleFactor(
   }
 }
 
-static void YGRoundToPixelGrid(
+// Same as `fmod(value, 1.0)`: subtracting the integral part is exact, but
+// unlike `fmod` it can be vectorized.
+static inline double YGFractionalPart(const double value) {
+  return std::copysign(value - std::trunc(value), value);
+}
+
+// Same as `YGDoubleEqual` for defined values; false if any of them is NaN.
+static inline bool YGDoubleIsNearlyEqual(const double a, const double b) {
+  return std::fabs(a - b) < 0.0001;
+}
+
+// Same as calling `YGRoundValueToPixelGrid` for each of the values, but
+// without branches, so that the compiler can vectorize the loop.
+template <size_t N>
+static inline void YGRoundValuesToPixelGrid(
+    const double (&values)[N],
+    const double pointScaleFactor,
+    const bool (&forceCeil)[N],
+    const bool (&forceFloor)[N],
+    float (&roundedValues)[N]) {
+  for (size_t i = 0; i < N; i++) {
+    const double scaledValue = values[i] * pointScaleFactor;
+    double fractial = YGFractionalPart(scaledValue);
+    fractial = fractial < 0 ? fractial + 1.0 : fractial;
+
+    const bool isWhole = YGDoubleIsNearlyEqual(fractial, 0.0);
+    const bool roundsUp = !isWhole &&
+        (YGDoubleIsNearlyEqual(fractial, 1.0) || forceCeil[i] ||
+         (!forceFloor[i] &&
+          (fractial > 0.5 || YGDoubleIsNearlyEqual(fractial, 0.5))));
+    const double roundedValue =
+        scaledValue - fractial + (roundsUp ? 1.0 : 0.0);
+
+    roundedValues[i] = std::isnan(roundedValue) || std::isnan(pointScaleFactor)
+        ? YGUndefined
+        : (float) (roundedValue / pointScaleFactor);
+  }
+}
+
+// Returns `true` if rounding did not change any value in the subtree.
+static bool YGRoundToPixelGrid(
     const YGNodeRef node,
     const double pointScaleFactor,
     const double absoluteLeft,
-    const double absoluteTop) {
+    const double absoluteTop,
+    const uint32_t generationCount) {
   if (pointScaleFactor == 0.0f) {
-    return;
+    return true;
   }
 
   const double nodeLeft = node->getLayout().position[YGEdgeLeft];
@@ -4109,51 +4313,226 @@ static void YGRoundToPixelGrid(
   // size as this could lead to unwanted text truncation.
   const bool textRounding = node->getNodeType() == YGNodeTypeText;
 
-  node->setLayoutPosition(
-      YGRoundValueToPixelGrid(nodeLeft, pointScaleFactor, false, textRounding),
-      YGEdgeLeft);
-
-  node->setLayoutPosition(
-      YGRoundValueToPixelGrid(nodeTop, pointScaleFactor, false, textRounding),
-      YGEdgeTop);
-
   // We multiply dimension by scale factor and if the result is close to the
   // whole number, we don't have any fraction To verify if the result is close
   // to whole number we want to check both floor and ceil numbers
-  const bool hasFractionalWidth =
-      !YGDoubleEqual(fmod(nodeWidth * pointScaleFactor, 1.0), 0) &&
-      !YGDoubleEqual(fmod(nodeWidth * pointScaleFactor, 1.0), 1.0);
+  const double widthFraction = YGFractionalPart(nodeWidth * pointScaleFactor);
+  const double heightFraction = YGFractionalPart(nodeHeight * pointScaleFactor);
+  const bool hasFractionalWidth = !YGDoubleIsNearlyEqual(widthFraction, 0.0) &&
+      !YGDoubleIsNearlyEqual(widthFraction, 1.0);
   const bool hasFractionalHeight =
-      !YGDoubleEqual(fmod(nodeHeight * pointScaleFactor, 1.0), 0) &&
-      !YGDoubleEqual(fmod(nodeHeight * pointScaleFactor, 1.0), 1.0);
-
-  node->setLayoutDimension(
-      YGRoundValueToPixelGrid(
-          absoluteNodeRight,
-          pointScaleFactor,
-          (textRounding && hasFractionalWidth),
-          (textRounding && !hasFractionalWidth)) -
-          YGRoundValueToPixelGrid(
-              absoluteNodeLeft, pointScaleFactor, false, textRounding),
-      YGDimensionWidth);
-
-  node->setLayoutDimension(
-      YGRoundValueToPixelGrid(
-          absoluteNodeBottom,
-          pointScaleFactor,
-          (textRounding && hasFractionalHeight),
-          (textRounding && !hasFractionalHeight)) -
-          YGRoundValueToPixelGrid(
-              absoluteNodeTop, pointScaleFactor, false, textRounding),
-      YGDimensionHeight);
-
+      !YGDoubleIsNearlyEqual(heightFraction, 0.0) &&
+      !YGDoubleIsNearlyEqual(heightFraction, 1.0);
+
+  // All edges of the node are rounded at once.
+  const double values[6] = {
+      nodeLeft,
+      nodeTop,
+      absoluteNodeLeft,
+      absoluteNodeTop,
+      absoluteNodeRight,
+      absoluteNodeBottom};
+  const bool forceCeil[6] = {
+      false,
+      false,
+      false,
+      false,
+      textRounding && hasFractionalWidth,
+      textRounding && hasFractionalHeight};
+  const bool forceFloor[6] = {
+      textRounding,
+      textRounding,
+      textRounding,
+      textRounding,
+      textRounding && !hasFractionalWidth,
+      textRounding && !hasFractionalHeight};
+  float roundedValues[6];
+  YGRoundValuesToPixelGrid(
+      values, pointScaleFactor, forceCeil, forceFloor, roundedValues);
+
+  const float roundedWidth = roundedValues[4] - roundedValues[2];
+  const float roundedHeight = roundedValues[5] - roundedValues[3];
+  bool isStable = roundedValues[0] == node->getLayout().position[YGEdgeLeft] &&
+      roundedValues[1] == node->getLayout().position[YGEdgeTop] &&
+      roundedWidth == node->getLayout().dimensions[YGDimensionWidth] &&
+      roundedHeight == node->getLayout().dimensions[YGDimensionHeight];
+
+  node->setLayoutPosition(roundedValues[0], YGEdgeLeft);
+  node->setLayoutPosition(roundedValues[1], YGEdgeTop);
+  node->setLayoutDimension(roundedWidth, YGDimensionWidth);
+  node->setLayoutDimension(roundedHeight, YGDimensionHeight);
+
+  const bool skipUnchangedSubtrees =
+      node->getConfig()->skipUnchangedSubtreesWhenRounding;
   const uint32_t childCount = YGNodeGetChildCount(node);
   for (uint32_t i = 0; i < childCount; i++) {
-    YGRoundToPixelGrid(
-        YGNodeGetChild(node, i),
+    const YGNodeRef child = YGNodeGetChild(node, i);
+    auto& childLayout = child->getLayout();
+    // Rounding is not idempotent: rounding already rounded values (which is
+    // what happens to subtrees not visited by the current layout pass) can
+    // still change them. A subtree can only be skipped if it was not visited
+    // by the current layout pass (so it holds exactly the values produced by
+    // its last rounding), that rounding did not change anything, and it was
+    // done from the same owner position; rounding it again would then
+    // produce exactly the same values.
+    if (skipUnchangedSubtrees &&
+        childLayout.generationCount != generationCount &&
+        childLayout.hadStableRounding() &&
+        childLayout.lastRoundingOwnerPosition[0] == absoluteNodeLeft &&
+        childLayout.lastRoundingOwnerPosition[1] == absoluteNodeTop) {
+      continue;
+    }
+    const bool isChildStable = YGRoundToPixelGrid(
+        child,
         pointScaleFactor,
         absoluteNodeLeft,
-        absoluteNodeTop);
+        absoluteNodeTop,
+        generationCount);
+    childLayout.lastRoundingOwnerPosition = {
+        {absoluteNodeLeft, absoluteNodeTop}};
+    childLayout.setHadStableRounding(isChildStable);
+    isStable = isStable && isChildStable;
+  }
+
+  return isStable;
+}
+
+static void YGMergeLayoutData(LayoutData& target, const LayoutData& source) {
+  target.layouts += source.layouts;
+  target.measures += source.measures;
+  target.maxMeasureCache =
+      std::max(target.maxMeasureCache, source.maxMeasureCache);
+  target.cachedLayouts += source.cachedLayouts;
+  target.cachedMeasures += source.cachedMeasures;
+  target.measureCallbacks += source.measureCallbacks;
+  for (size_t i = 0; i < target.measureCallbackReasonsCount.size(); i++) {
+    target.measureCallbackReasonsCount[i] +=
+        source.measureCallbackReasonsCount[i];
+  }
+}
+
+static bool YGHasPendingAncestor(YGNodeRef node, const YGNodeRef root) {
+  while (node != root && (node = node->getOwner()) != nullptr) {
+    if (node->getLayout().hasPendingLayout()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// A node whose layout was deferred can be laid out again within the same pass
+// (e.g. in different measure modes), leaving layouts deferred by the previous
+// layout pending in its subtree. Such layouts cannot run concurrently with the
+// layout of the node, so they are performed right away (this is rare).
+static void YGPerformNestedPendingLayouts(YGDeferredLayouts& deferredLayouts) {
+  auto previousDeferredLayouts = gDeferredLayouts;
+  gDeferredLayouts = &deferredLayouts;
+
+  auto& layouts = deferredLayouts.layouts;
+  // The layouts can grow during the loop.
+  for (size_t i = 0; i < layouts.size(); i++) {
+    if (!layouts[i].isPending ||
+        !YGHasPendingAncestor(layouts[i].node, deferredLayouts.root)) {
+      continue;
+    }
+    layouts[i].isPending = false;
+    layouts[i].node->getLayout().setHasPendingLayout(false);
+    const auto deferredLayout = layouts[i];
+    YGPerformDeferredLayout(deferredLayout, *deferredLayouts.layoutMarkerData);
+  }
+
+  gDeferredLayouts = previousDeferredLayouts;
+}
+
+struct YGParallelLayoutPass {
+  WorkStealingPool& pool;
+  WorkStealingPool::Group group;
+  std::mutex mutex;
+  LayoutData& layoutMarkerData;
+  std::vector<YGNodeRef> deferredNodes;
+};
+
+static void YGSpawnDeferredLayouts(
+    YGParallelLayoutPass& pass,
+    std::vector<YGDeferredLayout>& layouts);
+
+static void YGPerformDeferredLayoutTask(
+    YGParallelLayoutPass& pass,
+    const YGDeferredLayout& deferredLayout) {
+  LayoutData layoutMarkerData = {};
+  YGDeferredLayouts nestedLayouts{{}, &layoutMarkerData, deferredLayout.node};
+
+  auto previousDeferredLayouts = gDeferredLayouts;
+  gDeferredLayouts = &nestedLayouts;
+  YGPerformDeferredLayout(deferredLayout, layoutMarkerData);
+  gDeferredLayouts = previousDeferredLayouts;
+
+  YGPerformNestedPendingLayouts(nestedLayouts);
+
+  {
+    std::lock_guard<std::mutex> lock(pass.mutex);
+    YGMergeLayoutData(pass.layoutMarkerData, layoutMarkerData);
+  }
+
+  // Nested layouts are spawned only now, when nothing else on this thread
+  // touches their subtrees anymore.
+  YGSpawnDeferredLayouts(pass, nestedLayouts.layouts);
+}
+
+static void YGSpawnDeferredLayouts(
+    YGParallelLayoutPass& pass,
+    std::vector<YGDeferredLayout>& layouts) {
+  if (layouts.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(pass.mutex);
+    for (const auto& deferredLayout : layouts) {
+      pass.deferredNodes.push_back(deferredLayout.node);
+    }
+  }
+
+  for (auto& deferredLayout : layouts) {
+    if (!deferredLayout.isPending) {
+      continue;
+    }
+    deferredLayout.node->getLayout().setHasPendingLayout(false);
+    pass.pool.spawn(pass.group, [&pass, deferredLayout]() {
+      YGPerformDeferredLayoutTask(pass, deferredLayout);
+    });
+  }
+}
+
+// Performs the layouts deferred by the serial part of a pass (and, in turn,
+// the layouts deferred by them) on a pool of threads.
+static void YGPerformDeferredLayoutsInParallel(
+    const YGNodeRef root,
+    YGDeferredLayouts& deferredLayouts,
+    const uint32_t numberOfThreads,
+    LayoutData& layoutMarkerData) {
+  if (deferredLayouts.layouts.empty()) {
+    return;
+  }
+
+  YGParallelLayoutPass pass{
+      WorkStealingPool::shared(numberOfThreads), {}, {}, layoutMarkerData, {}};
+  YGPerformNestedPendingLayouts(deferredLayouts);
+  YGSpawnDeferredLayouts(pass, deferredLayouts.layouts);
+  pass.pool.wait(pass.group);
+
+  // Owners of deferred nodes could not take their overflow into account;
+  // it is propagated (conservatively) to all of their ancestors instead.
+  for (const auto deferredNode : pass.deferredNodes) {
+    if (!deferredNode->getLayout().hadOverflow()) {
+      continue;
+    }
+    auto node = deferredNode;
+    while (node != root && node->getOwner() != nullptr &&
+           !node->getOwner()->getLayout().hadOverflow()) {
+      node = node->getOwner();
+      node->setLayoutHadOverflow(true);
+    }
   }
 }
 
@@ -4169,8 +4548,10 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
 
   // Increment the generation count. This will force the recursive routine to
   // visit all dirty nodes at least once. Subsequent visits will be skipped if
-  // the input parameters don't change.
-  gCurrentGenerationCount.fetch_add(1, std::memory_order_relaxed);
+  // the input parameters don't change. The value is captured, as passes over
+  // different trees can run concurrently on different threads.
+  const uint32_t generationCount =
+      gCurrentGenerationCount.fetch_add(1, std::memory_order_relaxed) + 1;
   node->resolveDimension();
   float width = YGUndefined;
   YGMeasureMode widthMeasureMode = YGMeasureModeUndefined;
@@ -4212,25 +4593,40 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
     heightMeasureMode = YGFloatIsUndefined(height) ? YGMeasureModeUndefined
                                                    : YGMeasureModeExactly;
   }
-  if (YGLayoutNodeInternal(
-          node,
-          width,
-          height,
-          ownerDirection,
-          widthMeasureMode,
-          heightMeasureMode,
-          ownerWidth,
-          ownerHeight,
-          true,
-          LayoutPassReason::kInitial,
-          node->getConfig(),
-          markerData,
-          layoutContext,
-          0, // tree root
-          gCurrentGenerationCount.load(std::memory_order_relaxed))) {
+  const uint32_t parallelLayoutThreadCount =
+      node->getConfig()->parallelLayoutThreadCount;
+  YGDeferredLayouts deferredLayouts{{}, &markerData, node};
+  auto previousDeferredLayouts = gDeferredLayouts;
+  // Measure functions may lay out other trees (on the same thread).
+  gDeferredLayouts =
+      parallelLayoutThreadCount > 1 ? &deferredLayouts : nullptr;
+
+  const bool didLayout = YGLayoutNodeInternal(
+      node,
+      width,
+      height,
+      ownerDirection,
+      widthMeasureMode,
+      heightMeasureMode,
+      ownerWidth,
+      ownerHeight,
+      true,
+      LayoutPassReason::kInitial,
+      node->getConfig(),
+      markerData,
+      layoutContext,
+      0, // tree root
+      generationCount);
+
+  gDeferredLayouts = previousDeferredLayouts;
+  YGPerformDeferredLayoutsInParallel(
+      node, deferredLayouts, parallelLayoutThreadCount, markerData);
+
+  if (didLayout) {
     node->setPosition(
         node->getLayout().direction(), ownerWidth, ownerHeight, ownerWidth);
-    YGRoundToPixelGrid(node, node->getConfig()->pointScaleFactor, 0.0f, 0.0f);
+    YGRoundToPixelGrid(
+        node, node->getConfig()->pointScaleFactor, 0.0f, 0.0f, generationCount);
 
 #ifdef DEBUG
     if (node->getConfig()->printTree) {
@@ -4326,6 +4722,28 @@ bool YGConfigGetUseWebDefaults(const YGConfigRef config) {
   return config->useWebDefaults;
 }
 
+YOGA_EXPORT void YGConfigSetSkipUnchangedSubtreesWhenRounding(
+    const YGConfigRef config,
+    const bool enabled) {
+  config->skipUnchangedSubtreesWhenRounding = enabled;
+}
+
+YOGA_EXPORT bool YGConfigGetSkipUnchangedSubtreesWhenRounding(
+    const YGConfigRef config) {
+  return config->skipUnchangedSubtreesWhenRounding;
+}
+
+YOGA_EXPORT void YGConfigSetParallelLayoutThreadCount(
+    const YGConfigRef config,
+    const uint32_t threadCount) {
+  config->parallelLayoutThreadCount = threadCount;
+}
+
+YOGA_EXPORT uint32_t
+YGConfigGetParallelLayoutThreadCount(const YGConfigRef config) {
+  return config->parallelLayoutThreadCount;
+}
+
 YOGA_EXPORT void YGConfigSetContext(const YGConfigRef config, void* context) {
   config->context = context;
 }
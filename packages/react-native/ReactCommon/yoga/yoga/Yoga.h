@@ -343,6 +343,28 @@ WIN_EXPORT bool YGConfigIsExperimentalFeatureEnabled(
 WIN_EXPORT void YGConfigSetUseWebDefaults(YGConfigRef config, bool enabled);
 WIN_EXPORT bool YGConfigGetUseWebDefaults(YGConfigRef config);
 
+// By default, rounding to the pixel grid traverses the whole tree after every
+// layout pass. When enabled, subtrees which were not visited by the layout
+// pass are skipped if rounding them again would not change any value (their
+// last rounding changed nothing and their owner did not move), so the cost
+// of rounding scales with the size of the change. The results are the same as
+// with the option disabled.
+WIN_EXPORT void YGConfigSetSkipUnchangedSubtreesWhenRounding(
+    YGConfigRef config,
+    bool enabled);
+WIN_EXPORT bool YGConfigGetSkipUnchangedSubtreesWhenRounding(
+    YGConfigRef config);
+
+// When set to a value bigger than 1, layout passes over trees with this root
+// config postpone the layout of subtrees whose width and height are both
+// exactly defined (e.g. cards in a grid) and perform them concurrently on the
+// given number of threads. Measure, baseline, and clone functions of nodes in
+// such trees must be safe to call from any thread. Defaults to 0 (disabled).
+WIN_EXPORT void YGConfigSetParallelLayoutThreadCount(
+    YGConfigRef config,
+    uint32_t threadCount);
+WIN_EXPORT uint32_t YGConfigGetParallelLayoutThreadCount(YGConfigRef config);
+
 WIN_EXPORT void YGConfigSetCloneNodeFunc(
     YGConfigRef config,
     YGCloneNodeFunc callback);
@@ -416,6 +416,22 @@ def fb_xplat_cxx_test(**_kwargs):
     """A noop stub for OSS build."""
     pass
 
+def rn_xplat_cxx_benchmark(name, srcs, deps = [], compiler_flags = []):
+    """Defines a binary running the Google Benchmark benchmarks in `srcs`."""
+    native.cxx_binary(
+        name = name,
+        srcs = srcs,
+        compiler_flags = [
+            "-fexceptions",
+            "-frtti",
+            "-std=c++17",
+            "-Wall",
+        ] + compiler_flags,
+        preprocessor_flags = get_preprocessor_flags_for_build_mode(),
+        visibility = ["PUBLIC"],
+        deps = ["//xplat/third-party/benchmark:benchmark"] + deps,
+    )
+
 # iOS Plugin support.
 def react_module_plugin_providers(*args, **kwargs):
     # Noop for now